@@ -0,0 +1,202 @@
+/*
+  ==============================================================================
+    BufferPool.cpp
+    Created: 20 Apr 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the process-wide buffer pool (see BufferPool.h).
+  ==============================================================================
+*/
+
+#include "BufferPool.h"
+
+#if JUCE_WINDOWS
+ #include <windows.h>
+#else
+ #include <sys/mman.h>
+ #include <unistd.h>
+#endif
+
+BufferPool::~BufferPool()
+{
+    // every Buffer keeps the pool alive through its owner's SharedResourcePointer,
+    // so only cached blocks can be left here
+    jassert(stats.bytesInUse == 0);
+    stopTimer();
+    trim();
+}
+
+//==============================================================================
+BufferPool::Buffer::Buffer(Buffer&& other) noexcept
+    : pool(std::exchange(other.pool, nullptr)),
+      data(std::exchange(other.data, nullptr)),
+      capacity(std::exchange(other.capacity, 0)),
+      zeroed(std::exchange(other.zeroed, false))
+{
+}
+
+BufferPool::Buffer& BufferPool::Buffer::operator=(Buffer&& other) noexcept
+{
+    if (this != &other) {
+        reset();
+        pool = std::exchange(other.pool, nullptr);
+        data = std::exchange(other.data, nullptr);
+        capacity = std::exchange(other.capacity, 0);
+        zeroed = std::exchange(other.zeroed, false);
+    }
+    return *this;
+}
+
+void BufferPool::Buffer::reset()
+{
+    if (data != nullptr) {
+        pool->release(data, capacity);
+    }
+    pool = nullptr;
+    data = nullptr;
+    capacity = 0;
+    zeroed = false;
+}
+
+//==============================================================================
+BufferPool::Buffer BufferPool::acquire(size_t numFloats)
+{
+    size_t capacity = (juce::jmax(size_t(1), numFloats) + granularity - 1) / granularity * granularity;
+
+    Buffer buffer;
+    buffer.pool = this;
+
+    const juce::ScopedLock sl(lock);
+    stats.numAcquires += 1;
+
+    // smallest cached block that is large enough
+    auto it = std::lower_bound(freeBlocks.begin(), freeBlocks.end(), capacity,
+                               [](const FreeBlock& block, size_t size) { return block.capacity < size; });
+    if (it != freeBlocks.end()) {
+        buffer.data = it->data;
+        buffer.capacity = it->capacity;
+        freeBlocks.erase(it);
+        stats.bytesCached -= buffer.capacity * sizeof(float);
+        stats.numReused += 1;
+    } else {
+        buffer.data = allocate(capacity);
+        buffer.capacity = capacity;
+        buffer.zeroed = true;      // mmap / VirtualAlloc memory starts out as zero pages
+    }
+
+    stats.bytesInUse += buffer.capacity * sizeof(float);
+    stats.peakBytes = juce::jmax(stats.peakBytes, stats.bytesInUse + stats.bytesCached);
+    return buffer;
+}
+
+void BufferPool::release(float* data, size_t capacity)
+{
+    const juce::ScopedLock sl(lock);
+
+    auto it = std::lower_bound(freeBlocks.begin(), freeBlocks.end(), capacity,
+                               [](const FreeBlock& block, size_t size) { return block.capacity < size; });
+    freeBlocks.insert(it, { data, capacity, juce::Time::getMillisecondCounter() });
+
+    stats.bytesInUse -= capacity * sizeof(float);
+    stats.bytesCached += capacity * sizeof(float);
+
+    startTimer(1000); // check for stale blocks once a second while anything is cached
+}
+
+BufferPool::Stats BufferPool::getStats() const
+{
+    const juce::ScopedLock sl(lock);
+    return stats;
+}
+
+void BufferPool::trim(juce::uint32 maxAge)
+{
+    const juce::ScopedLock sl(lock);
+    auto now = juce::Time::getMillisecondCounter();
+
+    auto stale = std::stable_partition(freeBlocks.begin(), freeBlocks.end(), [&](const FreeBlock& block)
+                                       { return maxAge > 0 && now - block.releaseTime < maxAge; });
+    for (auto it = stale; it != freeBlocks.end(); ++it) {
+        deallocate(it->data, it->capacity);
+        stats.bytesCached -= it->capacity * sizeof(float);
+    }
+    freeBlocks.erase(stale, freeBlocks.end()); // kept blocks stay sorted (stable partition)
+}
+
+void BufferPool::timerCallback()
+{
+    trim(cacheHoldTime);
+
+    const juce::ScopedLock sl(lock);
+    if (freeBlocks.empty()) {
+        stopTimer();
+    }
+}
+
+//==============================================================================
+// Blocks come straight from the virtual memory system: page aligned, zero-filled,
+// and only backed by physical memory once written.
+float* BufferPool::allocate(size_t numFloats)
+{
+    size_t bytes = numFloats * sizeof(float);
+   #if JUCE_WINDOWS
+    void* data = VirtualAlloc(nullptr, bytes, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+    if (data == nullptr) {
+        throw std::bad_alloc();
+    }
+   #else
+    void* data = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) {
+        throw std::bad_alloc();
+    }
+   #endif
+    return static_cast<float*>(data);
+}
+
+void BufferPool::deallocate(float* data, size_t numFloats) noexcept
+{
+   #if JUCE_WINDOWS
+    juce::ignoreUnused(numFloats);
+    VirtualFree(data, 0, MEM_RELEASE);
+   #else
+    munmap(data, numFloats * sizeof(float));
+   #endif
+}
+
+void BufferPool::clear(float* data, size_t numFloats) noexcept
+{
+    juce::FloatVectorOperations::clear(data, int(numFloats));
+}
+
+void BufferPool::prefault(float* data, size_t numFloats) noexcept
+{
+    if (data == nullptr || numFloats == 0) {
+        return;
+    }
+   #if JUCE_WINDOWS
+    static const size_t pageSize = [] { SYSTEM_INFO info; GetSystemInfo(&info); return size_t(info.dwPageSize); }();
+   #else
+    static const size_t pageSize = size_t(sysconf(_SC_PAGESIZE));
+   #endif
+    auto begin = reinterpret_cast<uintptr_t>(data);
+    auto end = begin + numFloats * sizeof(float);
+
+   #if JUCE_LINUX && defined(MADV_POPULATE_WRITE)
+    // one call maps every page writable (Linux 5.14+); older kernels fall through
+    auto pageBegin = begin / pageSize * pageSize;
+    if (madvise(reinterpret_cast<void*>(pageBegin), end - pageBegin, MADV_POPULATE_WRITE) == 0) {
+        return;
+    }
+   #endif
+
+    // write every page once; rewriting the value read keeps a recycled block's contents
+    for (auto address = begin; address < end; address = (address / pageSize + 1) * pageSize) {
+        auto* sample = reinterpret_cast<volatile float*>(address);
+        *sample = *sample;
+    }
+}
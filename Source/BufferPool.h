@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+    BufferPool.h
+    Created: 20 Apr 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Process-wide pool for the large sample buffers (delay lines). Every plug-in
+    instance allocated its own pair of 5 s buffers before; with the pool,
+    buffers given back in releaseResources are kept and handed to the next
+    instance (or the same one, on re-prepare) that asks for a similar size.
+     - blocks are whole pages from the OS (mmap / VirtualAlloc), rounded up
+       to a 16 KiB granularity; untouched pages cost address space only, so
+       reserving for the highest sample rate is free: owners prefault only
+       the part they actually use,
+     - acquire picks the smallest free block that is large enough,
+     - Stats shows what the whole session has committed (all instances),
+     - cached blocks nobody asked for within cacheHoldTime are freed, so
+       deactivated / frozen tracks really give their memory back while a
+       quick stop / start still re-prepares without allocating.
+    acquire / release lock a CriticalSection: call them from prepareToPlay /
+    releaseResources, never from the audio callback.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class BufferPool : private juce::Timer
+{
+public:
+    static constexpr size_t alignment = 64;              // bytes (guaranteed; blocks are page aligned)
+    static constexpr size_t granularity = 4096;          // floats per size step (16 KiB)
+    static constexpr juce::uint32 cacheHoldTime = 10000; // ms a released block is kept for reuse
+
+    BufferPool() = default;                              // public so SharedResourcePointer can create it
+    ~BufferPool() override;
+
+    // Move-only handle to a pooled block; gives the block back to the pool when
+    // reset or destroyed.
+    class Buffer
+    {
+    public:
+        Buffer() = default;
+        ~Buffer() { reset(); }
+
+        Buffer(Buffer&& other) noexcept;
+        Buffer& operator=(Buffer&& other) noexcept;
+
+        float* get() const noexcept { return data; }
+        size_t size() const noexcept { return capacity; }   // in floats (>= requested)
+        bool isValid() const noexcept { return data != nullptr; }
+        bool isZeroed() const noexcept { return zeroed; }   // fresh from the OS, not recycled
+
+        void reset();                                        // give the block back
+
+    private:
+        friend class BufferPool;
+
+        BufferPool* pool = nullptr;
+        float* data = nullptr;
+        size_t capacity = 0;
+        bool zeroed = false;
+
+        JUCE_DECLARE_NON_COPYABLE (Buffer)
+    };
+
+    // Hand out a block of at least numFloats floats. Contents are undefined unless
+    // Buffer::isZeroed() says it is a new block.
+    Buffer acquire(size_t numFloats);
+
+    // Memory accounting for the whole process (bytes)
+    struct Stats
+    {
+        size_t bytesInUse = 0;          // handed out to instances
+        size_t bytesCached = 0;         // given back, kept for reuse
+        size_t peakBytes = 0;           // highest inUse + cached so far
+        int numAcquires = 0;            // acquire() calls
+        int numReused = 0;              // ... served from the cache
+    };
+
+    Stats getStats() const;
+
+    // Zero numFloats floats with vector stores. The pages stay mapped: handing them back
+    // to the OS would make the audio thread fault them in again. Not for the audio thread.
+    static void clear(float* data, size_t numFloats) noexcept;
+
+    // Make sure every page of [data, data + numFloats) is backed by physical memory, so
+    // the audio thread never takes a page fault (and the mmap lock with it) when the
+    // write head enters a new page. Contents are kept. Not for the audio thread.
+    static void prefault(float* data, size_t numFloats) noexcept;
+
+    // Free cached blocks released more than maxAge ms ago (0 = all of them).
+    // Blocks in use are not affected.
+    void trim(juce::uint32 maxAge = 0);
+
+private:
+    void release(float* data, size_t capacity);
+    void timerCallback() override;                       // message thread: trim old cached blocks
+
+    static float* allocate(size_t numFloats);
+    static void deallocate(float* data, size_t numFloats) noexcept;
+
+    struct FreeBlock
+    {
+        float* data;
+        size_t capacity;
+        juce::uint32 releaseTime;          // Time::getMillisecondCounter() at release
+    };
+
+    juce::CriticalSection lock;
+    std::vector<FreeBlock> freeBlocks;     // sorted by capacity (best fit = lower_bound)
+    Stats stats;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BufferPool)
+};
@@ -0,0 +1,151 @@
+/*
+  ==============================================================================
+    ChannelWorkerPool.cpp
+    Created: 27 Apr 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the work-stealing channel pool (see ChannelWorkerPool.h).
+  ==============================================================================
+*/
+
+#include "ChannelWorkerPool.h"
+
+#if JUCE_INTEL
+ #include <emmintrin.h>
+#endif
+
+// Tell the CPU we're spin-waiting (frees pipeline resources for the other hyper-thread)
+static inline void cpuRelax() noexcept
+{
+   #if JUCE_INTEL
+    _mm_pause();
+   #elif JUCE_ARM && (JUCE_CLANG || JUCE_GCC)
+    __asm__ __volatile__ ("yield");
+   #endif
+}
+
+ChannelWorkerPool::~ChannelWorkerPool()
+{
+    release();
+}
+
+void ChannelWorkerPool::prepare(int maxTasks, double barrierBudgetMs, double idleTimeMs_)
+{
+    barrierBudgetTicks = juce::Time::secondsToHighResolutionTicks(barrierBudgetMs / 1000.0);
+    idleTimeMs.store(idleTimeMs_);
+    overBudget.store(false);
+
+    int numWorkers = juce::jmin(maxTasks - 1, juce::SystemStats::getNumCpus() - 1);
+    if (numWorkers == getNumWorkers()) {
+        return;
+    }
+
+    release();
+    for (int i = 0; i < numWorkers; ++i) {
+        workers.push_back(std::make_unique<Worker>(*this));
+        workers.back()->startThread(juce::Thread::Priority::highest);
+    }
+}
+
+void ChannelWorkerPool::release()
+{
+    for (auto& worker : workers) {
+        worker->signalThreadShouldExit();
+    }
+    for (auto& worker : workers) {
+        worker->stopThread(1000);
+    }
+    workers.clear();
+}
+
+void ChannelWorkerPool::run(Task task, void* context, int numTasks) noexcept
+{
+    if (workers.empty() || numTasks <= 1 || overBudget.load(std::memory_order_relaxed)) {
+        for (int i = 0; i < numTasks; ++i) {
+            task(context, i);
+        }
+        return;
+    }
+
+    // publish the job (fields first, then the new generation with index 0)
+    generation += 1;
+    jobTask.store(task, std::memory_order_relaxed);
+    jobContext.store(context, std::memory_order_relaxed);
+    jobNumTasks.store(numTasks, std::memory_order_relaxed);
+    tasksDone.store(0, std::memory_order_relaxed);
+    jobState.store(pack(generation, 0));  // polling workers pick it up: nothing to signal
+
+    runTasks(generation);
+
+    // barrier: wait for tasks that workers claimed but haven't finished yet. The wait
+    // can't be cut short (a worker is still writing this block's data), so an overrun
+    // only switches the following blocks to the calling thread.
+    if (tasksDone.load(std::memory_order_acquire) < numTasks) {
+        auto waitStart = juce::Time::getHighResolutionTicks();
+        while (tasksDone.load(std::memory_order_acquire) < numTasks) {
+            cpuRelax();
+        }
+        if (juce::Time::getHighResolutionTicks() - waitStart > barrierBudgetTicks) {
+            overBudget.store(true, std::memory_order_relaxed);
+        }
+    }
+}
+
+void ChannelWorkerPool::runTasks(juce::uint32 jobGeneration) noexcept
+{
+    auto task = jobTask.load(std::memory_order_relaxed);
+    auto* context = jobContext.load(std::memory_order_relaxed);
+    auto numTasks = juce::uint32(jobNumTasks.load(std::memory_order_relaxed));
+
+    auto state = jobState.load(std::memory_order_acquire);
+    for (;;) {
+        auto index = juce::uint32(state & 0xffffffff);
+        if (juce::uint32(state >> 32) != jobGeneration || index >= numTasks) {
+            return; // job finished or replaced
+        }
+        if (jobState.compare_exchange_weak(state, pack(jobGeneration, index + 1), std::memory_order_acq_rel)) {
+            task(context, int(index));
+            tasksDone.fetch_add(1, std::memory_order_release);
+            state = jobState.load(std::memory_order_acquire);
+        }
+    }
+}
+
+//==============================================================================
+ChannelWorkerPool::Worker::Worker(ChannelWorkerPool& p)
+    : juce::Thread("Delay channel worker"), pool(p)
+{
+}
+
+void ChannelWorkerPool::Worker::run()
+{
+    juce::uint32 seen = juce::uint32(pool.jobState.load() >> 32);
+    double lastJob = juce::Time::getMillisecondCounterHiRes();
+
+    while (!threadShouldExit()) {
+        auto current = juce::uint32(pool.jobState.load(std::memory_order_acquire) >> 32);
+        if (current != seen) {
+            seen = current;
+            pool.runTasks(seen);
+            lastJob = juce::Time::getMillisecondCounterHiRes();
+            continue;
+        }
+
+        // The host is processing: keep polling, so the next block's job is claimed as
+        // soon as it's published (yield lets other threads on this core run meanwhile).
+        if (juce::Time::getMillisecondCounterHiRes() - lastJob < pool.idleTimeMs.load(std::memory_order_relaxed)) {
+            cpuRelax();
+            juce::Thread::yield();
+            continue;
+        }
+
+        // Idle for several blocks (transport / engine stopped): poll slowly. The audio
+        // thread never signals us, so it runs the next job alone until we're back.
+        juce::Thread::sleep(1);
+    }
+}
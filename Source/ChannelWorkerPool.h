@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+    ChannelWorkerPool.h
+    Created: 27 Apr 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Small per-instance worker pool for splitting one block's independent
+    channel work (delay read + feedback filtering per channel) across cores,
+    for hosts that run each plug-in instance on a single thread.
+     - run() publishes a job; the audio thread and the workers all claim task
+       indices from one atomic counter (work stealing), so the audio thread
+       never waits for a worker that hasn't started yet: it simply does the
+       remaining tasks itself.
+     - the only wait is a spin on the completion counter for tasks a worker
+       has already claimed (lock-free barrier), normally the cost of one
+       task. It is timed against a budget: a worker that got descheduled
+       mid-task (busy machine) can stretch it far beyond that, so once one
+       wait overruns the budget, run() does every task on the calling thread
+       until the next prepare().
+     - the audio thread never wakes a worker (no mutex / condition variable
+       on the audio thread): workers keep polling (yielding) for jobs while
+       the host keeps calling, so they are ready at the start of each block.
+       Only after idleTimeMs without a job (several block periods: the host
+       stopped processing) do they fall back to polling once a millisecond;
+       the first block after that simply runs on the calling thread until a
+       worker picks up again.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class ChannelWorkerPool
+{
+public:
+    // Blocks shorter than this aren't worth waking a worker for: run() callers
+    // should process them on the calling thread.
+    static constexpr int minBlockSize = 128;
+
+    using Task = void (*)(void* context, int taskIndex);
+
+    ChannelWorkerPool() = default;
+    ~ChannelWorkerPool();
+
+    // Start up to maxTasks - 1 workers (fewer on machines with fewer cores), or
+    // stop them all with maxTasks <= 1. barrierBudgetMs: longest acceptable wait for
+    // the workers at the end of run(). idleTimeMs: how long workers keep polling
+    // without a job before they slow down (pass a few block periods). Also re-arms
+    // the pool after an overrun. Not for the audio thread.
+    void prepare(int maxTasks, double barrierBudgetMs, double idleTimeMs);
+    void release();
+
+    int getNumWorkers() const noexcept { return int(workers.size()); }
+
+    // A barrier wait overran the budget: run() is single-threaded until the next prepare()
+    bool isOverBudget() const noexcept { return overBudget.load(std::memory_order_relaxed); }
+
+    // Audio thread: run task(context, i) for i in [0, numTasks) and return when all
+    // of them have finished. Tasks must be independent of each other. Runs them all
+    // on the calling thread when there are no workers or the pool is over budget.
+    void run(Task task, void* context, int numTasks) noexcept;
+
+private:
+    class Worker : public juce::Thread
+    {
+    public:
+        explicit Worker(ChannelWorkerPool& pool);
+        void run() override;
+
+    private:
+        ChannelWorkerPool& pool;
+    };
+
+    // Job state: generation in the upper 32 bits, next unclaimed task index in the
+    // lower 32. Claiming a task is a compare-exchange that fails once the job's
+    // generation has moved on, so a late worker can never claim a newer job's task.
+    static juce::uint64 pack(juce::uint32 generation, juce::uint32 index) noexcept
+    {
+        return (juce::uint64(generation) << 32) | index;
+    }
+
+    void runTasks(juce::uint32 generation) noexcept; // claim and run tasks of one job
+
+    std::atomic<juce::uint64> jobState { 0 };
+    std::atomic<Task> jobTask { nullptr };
+    std::atomic<void*> jobContext { nullptr };
+    std::atomic<int> jobNumTasks { 0 };
+    std::atomic<int> tasksDone { 0 };
+    juce::uint32 generation = 0;                     // audio thread only
+
+    juce::int64 barrierBudgetTicks = 0;              // getHighResolutionTicks() units
+    std::atomic<double> idleTimeMs { 0.0 };          // workers poll at full rate this long after a job
+    std::atomic<bool> overBudget { false };          // set by run(), cleared by prepare()
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ChannelWorkerPool)
+};
@@ -0,0 +1,330 @@
+/*
+  ==============================================================================
+    BatchDelayEngine.cpp
+    Created: 8 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the batch engine. Each internal block runs three passes:
+     1. mono input of every instance, transposed to sample-major order,
+     2. the delay / feedback loop, one sample at a time across all instances
+        (the write and the filters are straight lane loops; only the
+        fractional read gathers, since each instance has its own delay),
+     3. the output mix, one instance at a time.
+  ==============================================================================
+*/
+
+#include "BatchDelayEngine.h"
+#include "DSP.h"           // panningEqualPower, interpolateCubic
+#include "TptFilter.h"     // makeTptCoefficients, tptTick
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+ #include <xmmintrin.h>    // MXCSR: flush denormals to zero
+#endif
+
+namespace
+{
+    constexpr float sqrt2 = 1.41421356237310f;   // TptCoefficients::R2 (no resonance peak)
+
+    // The host's audio thread usually has FTZ / DAZ set; a render tool might not. The
+    // filter states decay into denormals, which are very slow on x86.
+    struct ScopedFlushDenormals
+    {
+#if defined(__SSE__) || defined(_M_X64) || defined(_M_IX86)
+        ScopedFlushDenormals() noexcept : saved(_mm_getcsr()) { _mm_setcsr(saved | 0x8040); }
+        ~ScopedFlushDenormals() { _mm_setcsr(saved); }
+        unsigned int saved;
+#endif
+    };
+
+    float decibelsToGain(float db) noexcept
+    {
+        return db > -100.0f ? std::pow(10.0f, db * 0.05f) : 0.0f;
+    }
+}
+
+//==============================================================================
+void BatchDelayEngine::prepare(double newSampleRate, int newNumInstances, int newNumSettings,
+                               float maxDelayTime)
+{
+    sampleRate = newSampleRate;
+    numInstances = std::max(newNumInstances, 0);
+    numSlots = std::max(newNumSettings, 1);
+
+    delayCoeff = 1.0f - std::exp(-1.0f / (0.2f * float(sampleRate)));   // same glide as Parameters
+
+    // ring: longest delay + interpolation taps, rounded up so wrapping is a mask
+    maxDelayInSamples = int(std::ceil(maxDelayTime / 1000.0 * sampleRate));
+    ringFrames = 1;
+    while (ringFrames < maxDelayInSamples + 4) {
+        ringFrames <<= 1;
+    }
+
+    size_t lanes = size_t(numInstances);
+    size_t ringSize = size_t(ringFrames) * lanes;
+    ringL.assign(ringSize, 0.0f);
+    ringR.assign(ringSize, 0.0f);
+
+    slots.assign(size_t(numSlots), Slot {});
+    for (auto& slot : slots) {
+        for (auto* smoother : { &slot.gain, &slot.mix, &slot.feedback,
+                                &slot.stereo, &slot.lowCut, &slot.highCut }) {
+            smoother->reset(sampleRate, 0.02);                          // 20 ms, as Parameters
+        }
+    }
+    slotOf.assign(lanes, 0);
+
+    size_t rampSize = size_t(numSlots) * blockSize;
+    for (auto* ramp : { &delayRamp, &feedbackRamp, &panLRamp, &panRRamp, &mixRamp, &gainRamp }) {
+        ramp->assign(rampSize, 0.0f);
+    }
+
+    for (auto* lane : { &feedbackL, &feedbackR,
+                        &lowCutS1L, &lowCutS2L, &highCutS1L, &highCutS2L,
+                        &lowCutS1R, &lowCutS2R, &highCutS1R, &highCutS2R,
+                        &lowCutG, &lowCutH, &highCutG, &highCutH,
+                        &laneDelay, &laneFeedback, &lanePanL, &lanePanR }) {
+        lane->assign(lanes, 0.0f);
+    }
+
+    size_t blockScratch = lanes * blockSize;
+    monoBlock.assign(blockScratch, 0.0f);
+    wetBlockL.assign(blockScratch, 0.0f);
+    wetBlockR.assign(blockScratch, 0.0f);
+
+    reset();
+}
+
+void BatchDelayEngine::reset() noexcept
+{
+    std::fill(ringL.begin(), ringL.end(), 0.0f);
+    std::fill(ringR.begin(), ringR.end(), 0.0f);
+    writeFrame = ringFrames - 1;   // the next write goes to frame 0
+
+    for (auto* lane : { &feedbackL, &feedbackR,
+                        &lowCutS1L, &lowCutS2L, &highCutS1L, &highCutS2L,
+                        &lowCutS1R, &lowCutS2R, &highCutS1R, &highCutS2R }) {
+        std::fill(lane->begin(), lane->end(), 0.0f);
+    }
+
+    for (auto& slot : slots) {
+        const auto& s = slot.settings;
+        slot.gain.setCurrentAndTargetValue(decibelsToGain(s.gain));
+        slot.mix.setCurrentAndTargetValue(s.mix * 0.01f);
+        slot.feedback.setCurrentAndTargetValue(s.feedback * 0.01f);
+        slot.stereo.setCurrentAndTargetValue(s.stereo * 0.01f);
+        slot.lowCut.setCurrentAndTargetValue(s.lowCut);
+        slot.highCut.setCurrentAndTargetValue(s.highCut);
+        slot.delayTime = s.delayTime;
+    }
+    updateFilters();
+}
+
+void BatchDelayEngine::setSettings(int slotIndex, const Settings& settings) noexcept
+{
+    if (slotIndex < 0 || slotIndex >= numSlots) {
+        return;
+    }
+
+    auto& slot = slots[size_t(slotIndex)];
+    slot.settings = settings;
+    slot.gain.setTargetValue(decibelsToGain(settings.gain));
+    slot.mix.setTargetValue(settings.mix * 0.01f);
+    slot.feedback.setTargetValue(settings.feedback * 0.01f);
+    slot.stereo.setTargetValue(settings.stereo * 0.01f);
+    slot.lowCut.setTargetValue(settings.lowCut);
+    slot.highCut.setTargetValue(settings.highCut);
+}
+
+void BatchDelayEngine::assignSettings(int instance, int slotIndex) noexcept
+{
+    if (instance >= 0 && instance < numInstances && slotIndex >= 0 && slotIndex < numSlots) {
+        slotOf[size_t(instance)] = slotIndex;
+    }
+}
+
+void BatchDelayEngine::process(const float* const* inputL, const float* const* inputR,
+                               float* const* outputL, float* const* outputR, int numSamples) noexcept
+{
+    if (numInstances == 0) {
+        return;
+    }
+
+    ScopedFlushDenormals flushDenormals;
+
+    for (int offset = 0; offset < numSamples; offset += blockSize) {
+        processBlock(inputL, inputR, outputL, outputR, offset, std::min(blockSize, numSamples - offset));
+    }
+}
+
+//==============================================================================
+// Advance every slot's smoothers once per sample (however many instances share it).
+void BatchDelayEngine::computeRamps(int numSamples) noexcept
+{
+    float maxDelay = float(maxDelayInSamples);
+
+    for (size_t s = 0; s < size_t(numSlots); ++s) {
+        auto& slot = slots[s];
+        float targetDelay = std::clamp(slot.settings.delayTime, 5.0f, 1000.0f * maxDelay / float(sampleRate));
+
+        float* delay = delayRamp.data() + s * blockSize;
+        float* feedback = feedbackRamp.data() + s * blockSize;
+        float* panL = panLRamp.data() + s * blockSize;
+        float* panR = panRRamp.data() + s * blockSize;
+        float* mix = mixRamp.data() + s * blockSize;
+        float* gain = gainRamp.data() + s * blockSize;
+
+        for (int i = 0; i < numSamples; ++i) {
+            slot.delayTime += (targetDelay - slot.delayTime) * delayCoeff;
+            delay[i] = std::min(slot.delayTime / 1000.0f * float(sampleRate), maxDelay);
+
+            feedback[i] = slot.feedback.getNextValue();
+            panningEqualPower(slot.stereo.getNextValue(), panL[i], panR[i]);
+            mix[i] = slot.mix.getNextValue();
+            gain[i] = slot.gain.getNextValue();
+            slot.lowCut.getNextValue();
+            slot.highCut.getNextValue();
+        }
+    }
+}
+
+// Filter coefficients (once per block, see TptFilter.h): the tan() runs once per slot
+// whose cutoff moved, not per instance; the lanes then only gather their slot's values.
+void BatchDelayEngine::updateFilters() noexcept
+{
+    for (auto& slot : slots) {
+        float lowCut = slot.lowCut.getCurrentValue();
+        if (lowCut != slot.coeffLowCut) {
+            auto c = makeTptCoefficients(lowCut, sampleRate);
+            slot.lowCutG = c.g;
+            slot.lowCutH = c.h;
+            slot.coeffLowCut = lowCut;
+        }
+
+        float highCut = slot.highCut.getCurrentValue();
+        if (highCut != slot.coeffHighCut) {
+            auto c = makeTptCoefficients(highCut, sampleRate);
+            slot.highCutG = c.g;
+            slot.highCutH = c.h;
+            slot.coeffHighCut = highCut;
+        }
+    }
+
+    for (size_t m = 0; m < size_t(numInstances); ++m) {
+        const auto& slot = slots[size_t(slotOf[m])];
+        lowCutG[m] = slot.lowCutG;
+        lowCutH[m] = slot.lowCutH;
+        highCutG[m] = slot.highCutG;
+        highCutH[m] = slot.highCutH;
+    }
+}
+
+void BatchDelayEngine::processBlock(const float* const* inputL, const float* const* inputR,
+                                    float* const* outputL, float* const* outputR,
+                                    int offset, int numSamples) noexcept
+{
+    const size_t lanes = size_t(numInstances);
+    const int mask = ringFrames - 1;
+
+    computeRamps(numSamples);
+    updateFilters();
+
+    // 1. mono input, sample-major
+    for (size_t m = 0; m < lanes; ++m) {
+        const float* inL = inputL[m] + offset;
+        const float* inR = inputR[m] + offset;
+        for (int i = 0; i < numSamples; ++i) {
+            monoBlock[size_t(i) * lanes + m] = (inL[i] + inR[i]) * 0.5f;
+        }
+    }
+
+    // 2. delay loop: write with ping-pong cross-feedback, read, filter the feedback
+    float* __restrict fbL = feedbackL.data();
+    float* __restrict fbR = feedbackR.data();
+    float* __restrict ls1L = lowCutS1L.data();
+    float* __restrict ls2L = lowCutS2L.data();
+    float* __restrict hs1L = highCutS1L.data();
+    float* __restrict hs2L = highCutS2L.data();
+    float* __restrict ls1R = lowCutS1R.data();
+    float* __restrict ls2R = lowCutS2R.data();
+    float* __restrict hs1R = highCutS1R.data();
+    float* __restrict hs2R = highCutS2R.data();
+    const float* __restrict lg = lowCutG.data();
+    const float* __restrict lh = lowCutH.data();
+    const float* __restrict hg = highCutG.data();
+    const float* __restrict hh = highCutH.data();
+    float* __restrict delay = laneDelay.data();
+    float* __restrict feedback = laneFeedback.data();
+    float* __restrict panL = lanePanL.data();
+    float* __restrict panR = lanePanR.data();
+
+    for (int i = 0; i < numSamples; ++i) {
+        // this sample's values for every lane (a broadcast when all share one slot)
+        for (size_t m = 0; m < lanes; ++m) {
+            size_t index = size_t(slotOf[m]) * blockSize + size_t(i);
+            delay[m] = delayRamp[index];
+            feedback[m] = feedbackRamp[index];
+            panL[m] = panLRamp[index];
+            panR[m] = panRRamp[index];
+        }
+
+        writeFrame = (writeFrame + 1) & mask;
+        const float* __restrict x = monoBlock.data() + size_t(i) * lanes;
+        float* __restrict frameL = ringL.data() + size_t(writeFrame) * lanes;
+        float* __restrict frameR = ringR.data() + size_t(writeFrame) * lanes;
+        for (size_t m = 0; m < lanes; ++m) {
+            frameL[m] = x[m] * panL[m] + fbR[m];
+            frameR[m] = x[m] * panR[m] + fbL[m];
+        }
+
+        // fractional read (cubic, as DelayLine::read): the only gather
+        float* __restrict wetL = wetBlockL.data() + size_t(i) * lanes;
+        float* __restrict wetR = wetBlockR.data() + size_t(i) * lanes;
+        for (size_t m = 0; m < lanes; ++m) {
+            int integerDelay = int(delay[m]);
+            float fraction = delay[m] - float(integerDelay);
+            int a = writeFrame - integerDelay + 1;
+            size_t ia = size_t(a & mask) * lanes + m;
+            size_t ib = size_t((a - 1) & mask) * lanes + m;
+            size_t ic = size_t((a - 2) & mask) * lanes + m;
+            size_t id = size_t((a - 3) & mask) * lanes + m;
+            wetL[m] = interpolateCubic(ringL[ia], ringL[ib], ringL[ic], ringL[id], fraction);
+            wetR[m] = interpolateCubic(ringR[ia], ringR[ib], ringR[ic], ringR[id], fraction);
+        }
+
+        // feedback: gain, low cut (high-pass output), high cut (low-pass output)
+        for (size_t m = 0; m < lanes; ++m) {
+            float highpass = tptTick(wetL[m] * feedback[m], lg[m], sqrt2, lh[m], ls1L[m], ls2L[m]).highpass;
+            fbL[m] = tptTick(highpass, hg[m], sqrt2, hh[m], hs1L[m], hs2L[m]).lowpass;
+        }
+        for (size_t m = 0; m < lanes; ++m) {
+            float highpass = tptTick(wetR[m] * feedback[m], lg[m], sqrt2, lh[m], ls1R[m], ls2R[m]).highpass;
+            fbR[m] = tptTick(highpass, hg[m], sqrt2, hh[m], hs1R[m], hs2R[m]).lowpass;
+        }
+    }
+
+    // 3. output: (dry + wet * mix) * gain, per instance (in place is fine: same index)
+    for (size_t m = 0; m < lanes; ++m) {
+        const float* mix = mixRamp.data() + size_t(slotOf[m]) * blockSize;
+        const float* gain = gainRamp.data() + size_t(slotOf[m]) * blockSize;
+        const float* inL = inputL[m] + offset;
+        const float* inR = inputR[m] + offset;
+        float* outL = outputL[m] + offset;
+        float* outR = outputR[m] + offset;
+
+        for (int i = 0; i < numSamples; ++i) {
+            size_t index = size_t(i) * lanes + m;
+            float dryL = inL[i];
+            float dryR = inR[i];
+            outL[i] = (dryL + wetBlockL[index] * mix[i]) * gain[i];
+            outR[i] = (dryR + wetBlockR[index] * mix[i]) * gain[i];
+        }
+    }
+}
@@ -0,0 +1,121 @@
+/*
+  ==============================================================================
+    BatchDelayEngine.h
+    Created: 8 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    The plug-in's delay algorithm (stereo ping-pong write, cubic fractional
+    read, low cut / high cut in the feedback path, dry + wet * mix output)
+    for many independent instances at once, e.g. for a server-side stem
+    renderer running thousands of delay chains. Standard library only: no
+    JUCE, no GUI, nothing to initialise.
+     - state is structure-of-arrays across instances: the delay rings are
+       interleaved (frame * numInstances + instance) and every per-instance
+       value is an array indexed by instance, so the per-sample loops run
+       over instances and each SIMD lane is one instance,
+     - parameters live in settings slots. Any number of instances can share
+       one slot, and each slot is smoothed once per sample no matter how many
+       instances use it (same smoothing as Parameters: 20 ms linear ramps, a
+       one-pole glide for the delay time),
+     - cutoff changes take effect once per internal block, as in the
+       plug-in's block engine. Filter coefficients are computed per slot,
+       and only when its cutoffs moved, then copied into the lanes.
+    prepare allocates; setSettings / assignSettings / process don't.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <vector>
+#include "Smoothers.h"
+
+class BatchDelayEngine
+{
+public:
+    // Plain parameter values, same units and ranges as the plug-in parameters
+    struct Settings
+    {
+        float delayTime = 100.0f;   // ms (5 .. maxDelayTime)
+        float feedback = 0.0f;      // % (-100 .. 100)
+        float stereo = 0.0f;        // % (-100 .. 100)
+        float lowCut = 20.0f;       // Hz
+        float highCut = 20000.0f;   // Hz
+        float mix = 100.0f;         // %
+        float gain = 0.0f;          // dB
+    };
+
+    static constexpr int blockSize = 256;   // internal block: ramps / scratch length
+
+    // numInstances delay chains drawing from numSettings parameter slots. Every instance
+    // starts on slot 0; all slots start at Settings {} (without smoothing).
+    void prepare(double sampleRate, int numInstances, int numSettings = 1,
+                 float maxDelayTime = 5000.0f);
+
+    // Silence all delay lines and filters, and jump every slot to its target.
+    void reset() noexcept;
+
+    // New target values for a slot; instances using it glide there.
+    void setSettings(int slot, const Settings& settings) noexcept;
+
+    // Let an instance follow another slot from now on.
+    void assignSettings(int instance, int slot) noexcept;
+
+    int getNumInstances() const noexcept { return numInstances; }
+
+    // Process numSamples of every instance. Each array has numInstances channel
+    // pointers; inputs and outputs may be the same buffers (in place), and a mono
+    // source can pass the same pointer for L and R.
+    void process(const float* const* inputL, const float* const* inputR,
+                 float* const* outputL, float* const* outputR, int numSamples) noexcept;
+
+private:
+    // One settings slot: its smoothers and filter coefficients
+    struct Slot
+    {
+        Settings settings;
+        LinearSmoother gain, mix, feedback, stereo, lowCut, highCut;
+        float delayTime = 0.0f;       // one-pole smoothed (ms)
+
+        float coeffLowCut = -1.0f;    // cutoffs the coefficients below are for (-1 = none yet)
+        float coeffHighCut = -1.0f;
+        float lowCutG = 0.0f, lowCutH = 0.0f, highCutG = 0.0f, highCutH = 0.0f;
+    };
+
+    void processBlock(const float* const* inputL, const float* const* inputR,
+                      float* const* outputL, float* const* outputR,
+                      int offset, int numSamples) noexcept;
+    void computeRamps(int numSamples) noexcept;
+    void updateFilters() noexcept;
+
+    double sampleRate = 44100.0;
+    int numInstances = 0;
+    int numSlots = 0;
+    float delayCoeff = 0.0f;         // one-pole coefficient of the delay glide
+    int maxDelayInSamples = 0;
+
+    std::vector<Slot> slots;
+    std::vector<int> slotOf;         // per instance
+
+    // Per-slot ramps for the current block: [slot * blockSize + i]
+    std::vector<float> delayRamp, feedbackRamp, panLRamp, panRRamp, mixRamp, gainRamp;
+
+    // Delay rings, interleaved across instances: [frame * numInstances + instance]
+    std::vector<float> ringL, ringR;
+    int ringFrames = 0;              // power of two
+    int writeFrame = 0;              // frame of the most recent write
+
+    // Per-instance state (lanes)
+    std::vector<float> feedbackL, feedbackR;              // last filtered feedback
+    std::vector<float> lowCutS1L, lowCutS2L, highCutS1L, highCutS2L;
+    std::vector<float> lowCutS1R, lowCutS2R, highCutS1R, highCutS2R;
+    std::vector<float> lowCutG, lowCutH, highCutG, highCutH; // filter coefficients per lane
+
+    // Block scratch, sample-major like the rings: [i * numInstances + instance]
+    std::vector<float> monoBlock, wetBlockL, wetBlockR;
+    std::vector<float> laneDelay, laneFeedback, lanePanL, lanePanR; // one sample's values
+};
@@ -0,0 +1,24 @@
+/*
+  ==============================================================================
+    CoreAssert.h
+    Created: 10 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Debug assertion for the JUCE-independent core (Source/Core). Plain
+    assert() unless the build defines CORE_ASSERT itself, e.g. to route it to
+    jassert or to a test framework. Like jassert it is compiled out in release
+    builds (NDEBUG).
+  ==============================================================================
+*/
+
+#pragma once
+
+#ifndef CORE_ASSERT
+ #include <cassert>
+ #define CORE_ASSERT(expression) assert(expression)
+#endif
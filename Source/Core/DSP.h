@@ -0,0 +1,60 @@
+/*
+  ==============================================================================
+    DSP.h
+    Created: 18 Jan 2026
+    Author:  Michael Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+ 
+    Note:   DSP.h provides tiny, header-only helpers:
+            - panningEqualPower computes equal‑power panning gains for left
+              and right channels. Call it with panning in [-1..1]; it writes
+              left/right gain values (≈0..1) via reference.
+            - interpolateCubic is the 4-point fractional-delay interpolation
+              shared by DelayRing, the resonator voices and the batch engine.
+ 
+            The functions are inline so they can be defined in the header
+            without violating C++ One Definition Rule. Part of the
+            JUCE-independent core (Source/Core).
+  ==============================================================================
+*/
+
+#pragma once // ensure this header is included only once per translation unit
+
+#include <cmath>    // std::cos, std::sin used for gain calculations
+
+// note: inline used because the implementation lives in the header
+// note: constant 0.7853981633974483f = pi / 4
+// output gains are written to left and right via reference (float&)
+inline void panningEqualPower(float panning, float& left, float& right)
+{
+    // Map panning [-1..1] to angle in radians.
+    // When panning == -1 -> x = 0       -> left = cos(0)=1, right = sin(0)=0 (full left)
+    // When panning ==  0 -> x = pi/4    -> left = right = 0.707... (center, equal power)
+    // When panning == +1 -> x = pi/2    -> left = cos(pi/2)=0, right = 1 (full right)
+    float x = 0.7853981633974483f * (panning + 1.0f);
+
+    // Equal-power panning uses cos/sin of the mapped angle to produce gains.
+    left = std::cos(x);
+    right = std::sin(x);
+}
+
+// 4-point interpolation between sampleB (integer delay) and sampleC, from the newest
+// sample A to the oldest D; fraction in [0..1) moves from B towards C.
+inline float interpolateCubic(float sampleA, float sampleB, float sampleC, float sampleD,
+                              float fraction) noexcept
+{
+    // The following compute slopes and coefficients for a 4-point interpolation
+    // (a form of cubic interpolation—Hermite-like / cubic Lagrange mix).
+    float slope0 = (sampleC - sampleA) * 0.5f;      // slope between A and C (approx derivative)
+    float slope1 = (sampleD - sampleB) * 0.5f;      // slope between B and D
+    float v = sampleB - sampleC;                            // difference between adjacent center samples
+    float w = slope0 + v;                                           // helper term
+    float a = w + v + slope1;                                    // cubic coefficient a
+    float b = w + a;                                                  // cubic coefficient b
+    float stage1 = a * fraction - b;                         // intermediate polynomial evaluation
+    float stage2 = stage1 * fraction + slope0;      // next stage
+    return stage2 * fraction + sampleB;               // final evaluated interpolated value, anchored at sampleB
+}
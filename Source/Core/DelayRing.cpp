@@ -0,0 +1,216 @@
+/*
+  ==============================================================================
+    DelayRing.cpp
+    Created: 10 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Circular buffer with fractional (cubic) interpolation on reads; moved
+    here from DelayLine.cpp so it builds without JUCE.
+  ==============================================================================
+*/
+
+#include "DelayRing.h"
+#include "DSP.h"          // interpolateCubic
+#include "CoreAssert.h"
+
+#include <algorithm>
+
+// Constant-delay run without wrap-around: oldest[k + 3 .. k] are A .. D of output k,
+// so the loop is a plain stencil over contiguous memory and vectorizes.
+static void interpolateRun(const float* __restrict oldest, float* __restrict output,
+                           int numSamples, float fraction) noexcept
+{
+    for (int k = 0; k < numSamples; ++k) {
+        output[k] = interpolateCubic(oldest[k + 3], oldest[k + 2], oldest[k + 1], oldest[k], fraction);
+    }
+}
+
+void DelayRing::attach(float* data, int newCapacity, bool zeroed) noexcept
+{
+    CORE_ASSERT(data != nullptr && newCapacity > 0);
+
+    buffer = data;
+    capacity = newCapacity;
+    length = std::min(length, capacity);
+    dirtyLength = zeroed ? 0 : capacity;      // unknown contents count as dirty
+    writeIndex = 0;
+}
+
+void DelayRing::detach() noexcept
+{
+    buffer = nullptr;
+    capacity = 0;
+    length = 0;
+    dirtyLength = 0;
+    writeIndex = 0;
+}
+
+void DelayRing::setLength(int newLength) noexcept
+{
+    CORE_ASSERT(newLength > 0 && newLength <= capacity);
+    length = newLength;
+}
+
+// Writes after a reset start at index 0 and move up, so everything at or above the
+// high-water mark dirtyLength is still silent: only [0, dirtyLength) needs clearing.
+void DelayRing::reset() noexcept
+{
+    std::fill(buffer, buffer + dirtyLength, 0.0f);
+    markSilent();
+}
+
+void DelayRing::markSilent() noexcept
+{
+    writeIndex = length - 1;                  // set writeIndex so next write increments to 0 (wrap behavior)
+    dirtyLength = 0;
+}
+
+// Write a single sample into the buffer at the current write position (real-time safe).
+void DelayRing::write(float input) noexcept
+{
+    CORE_ASSERT(length > 0);                // ensure buffer was allocated
+
+    writeIndex += 1;                          // advance the write index
+    if (writeIndex >= length) {        // wrap if we've reached the end
+        writeIndex = 0;
+    }
+
+    buffer[size_t(writeIndex)] = input;      // store the input sample at the write position
+
+    if (writeIndex >= dirtyLength) {          // raise the high-water mark (until the first wrap)
+        dirtyLength = writeIndex + 1;
+    }
+}
+
+// Read a delayed sample using fractional delay (cubic-style interpolation).
+float DelayRing::read(float delayInSamples) const noexcept
+{
+    return readAt(writeIndex, delayInSamples);
+}
+
+// Read a whole block ahead of the writes: step the write position the way
+// numSamples write() calls would, without writing anything.
+void DelayRing::readBlock(const float* delays, float* output, int numSamples) const noexcept
+{
+    int position = writeIndex;
+    for (int i = 0; i < numSamples; ++i) {
+        CORE_ASSERT(delays[i] >= float(numSamples + 1)); // must not read samples of this block
+
+        position += 1;
+        if (position >= length) {
+            position = 0;
+        }
+        output[i] = readAt(position, delays[i]);
+    }
+}
+
+// Constant delay: the four taps of consecutive outputs are consecutive samples, so
+// apart from the few outputs whose taps straddle the end of the buffer this is one
+// or two contiguous interpolation runs.
+void DelayRing::readBlock(float delayInSamples, float* output, int numSamples) const noexcept
+{
+    CORE_ASSERT(delayInSamples >= float(numSamples + 1));   // must not read samples of this block
+    CORE_ASSERT(delayInSamples <= float(length) - 2.0f);
+
+    int integerDelay = int(delayInSamples);
+    float fraction = delayInSamples - float(integerDelay);
+    const float* data = buffer;
+
+    // index of tap A (newest) for output 0: one write ahead of writeIndex, see readAt()
+    int indexA = writeIndex + 2 - integerDelay;
+    if (indexA < 0) {
+        indexA += length;
+    } else if (indexA >= length) {
+        indexA -= length;
+    }
+
+    int i = 0;
+    while (i < numSamples) {
+        if (indexA >= 3) {
+            // taps D .. A don't wrap: run until A reaches the end of the buffer
+            int run = std::min(numSamples - i, length - indexA);
+            interpolateRun(data + indexA - 3, output + i, run, fraction);
+            i += run;
+            indexA += run;
+        } else {
+            // taps wrap around the start of the buffer
+            auto wrap = [this](int index) { return index < 0 ? index + length : index; };
+            output[i] = interpolateCubic(data[indexA], data[wrap(indexA - 1)],
+                                    data[wrap(indexA - 2)], data[wrap(indexA - 3)], fraction);
+            i += 1;
+            indexA += 1;
+        }
+        if (indexA >= length) {
+            indexA = 0;
+        }
+    }
+}
+
+// Copy a block into the ring in at most two pieces (the same as numSamples write() calls).
+void DelayRing::writeBlock(const float* input, int numSamples) noexcept
+{
+    CORE_ASSERT(length > 0);
+    CORE_ASSERT(numSamples <= length);
+
+    float* data = buffer;
+    int start = writeIndex + 1;
+    if (start >= length) {
+        start = 0;
+    }
+
+    int first = std::min(numSamples, length - start);
+    std::copy(input, input + first, data + start);
+    std::copy(input + first, input + numSamples, data);
+
+    writeIndex = numSamples > first ? numSamples - first - 1 : start + first - 1;
+
+    // high-water mark: the highest index written (the whole buffer once it wrapped)
+    dirtyLength = numSamples > first ? length : std::max(dirtyLength, start + first);
+}
+
+float DelayRing::readAt(int position, float delayInSamples) const noexcept
+{
+    CORE_ASSERT(delayInSamples >= 1.0f);                     // require at least 1 sample delay
+    CORE_ASSERT(delayInSamples <= float(length) - 2.0f);     // ensure there's room for interpolation (padding)
+
+    int integerDelay = int(delayInSamples);             // integer part of the delay
+
+    // Calculate base read indices relative to the write position.
+    // These pick four consecutive samples needed for the interpolation.
+    int readIndexA = position - integerDelay + 1;       // nearest sample "A"
+    int readIndexB = readIndexA - 1;                                // sample "B"
+    int readIndexC = readIndexA - 2;                                // sample "C"
+    int readIndexD = readIndexA - 3;                                // sample "D"
+
+    // If any index is negative, wrap them by adding length so indices remain valid.
+    // This nested structure updates D, C, B, A only if needed (minimizes branches).
+    if (readIndexD < 0) {
+        readIndexD += length;
+        if (readIndexC < 0) {
+            readIndexC += length;
+            if (readIndexB < 0) {
+                readIndexB += length;
+                if (readIndexA < 0) {
+                    readIndexA += length;
+                }
+            }
+        }
+    }
+
+    // Fetch the four samples from the circular buffer used by the interpolation routine.
+    const float* data = buffer;
+    float sampleA = data[size_t(readIndexA)];
+    float sampleB = data[size_t(readIndexB)];
+    float sampleC = data[size_t(readIndexC)];
+    float sampleD = data[size_t(readIndexD)];
+
+    // Compute fractional part between integerDelay and the requested delay.
+    float fraction = delayInSamples - float(integerDelay);
+
+    return interpolateCubic(sampleA, sampleB, sampleC, sampleD, fraction);
+}
@@ -0,0 +1,63 @@
+/*
+  ==============================================================================
+    DelayRing.h
+    Created: 10 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    The circular buffer and cubic fractional read behind DelayLine, without
+    JUCE. DelayRing doesn't own its memory: the caller attaches a float
+    array (DelayLine uses the plug-in's BufferPool, a benchmark can use a
+    std::vector) and keeps it alive. Nothing here allocates, so every
+    method is real-time safe.
+  ==============================================================================
+*/
+
+#pragma once
+
+class DelayRing
+{
+public:
+    // Use data[0, capacity) as the buffer. zeroed tells whether it is known to be
+    // silent; otherwise the whole array counts as dirty until the next reset().
+    void attach(float* data, int capacity, bool zeroed) noexcept;
+
+    // Forget the buffer (the caller is about to free it).
+    void detach() noexcept;
+
+    // Active length in samples (<= capacity), including the 2 samples of
+    // interpolation padding.
+    void setLength(int newLength) noexcept;
+    int getLength() const noexcept { return length; }
+
+    // Samples [0, dirtyLength) may be non-zero; the rest of the buffer is silent.
+    int getDirtyLength() const noexcept { return dirtyLength; }
+
+    // Clear the dirty part of the buffer and restart at index 0.
+    void reset() noexcept;
+
+    // Restart at index 0 after the caller cleared [0, getDirtyLength()) itself
+    // (e.g. with a faster page-level clear).
+    void markSilent() noexcept;
+
+    // Same contract as DelayLine's write / read / readBlock / writeBlock.
+    void write(float input) noexcept;
+    float read(float delayInSamples) const noexcept;
+    void readBlock(const float* delays, float* output, int numSamples) const noexcept;
+    void readBlock(float delayInSamples, float* output, int numSamples) const noexcept;
+    void writeBlock(const float* input, int numSamples) noexcept;
+
+private:
+    // read() relative to a given write position
+    float readAt(int position, float delayInSamples) const noexcept;
+
+    float* buffer = nullptr;         // caller-owned samples
+    int capacity = 0;                // samples the buffer can hold
+    int length = 0;                  // active length of the circular buffer in samples (<= capacity)
+    int dirtyLength = 0;             // samples [0, dirtyLength) may be non-zero
+    int writeIndex = 0;              // index where the most recent value was written (next write will overwrite at this pos)
+};
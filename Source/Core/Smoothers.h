@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+    Smoothers.h
+    Created: 10 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Parameter smoothing for the JUCE-independent core. LinearSmoother
+    behaves like juce::LinearSmoothedValue: a new target is reached in a
+    fixed number of equal steps (the ramp length set by reset()).
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+
+class LinearSmoother
+{
+public:
+    // Ramp length for later targets
+    void reset(double sampleRate, double rampLengthInSeconds) noexcept
+    {
+        stepsToTarget = int(std::floor(rampLengthInSeconds * sampleRate));
+        setCurrentAndTargetValue(target);
+    }
+
+    void setCurrentAndTargetValue(float value) noexcept
+    {
+        current = target = value;
+        countdown = 0;
+    }
+
+    void setTargetValue(float value) noexcept
+    {
+        if (value == target) {
+            return;
+        }
+        if (stepsToTarget <= 0) {
+            setCurrentAndTargetValue(value);
+            return;
+        }
+        target = value;
+        countdown = stepsToTarget;
+        step = (target - current) / float(countdown);
+    }
+
+    float getNextValue() noexcept
+    {
+        if (countdown <= 0) {
+            return target;
+        }
+        --countdown;
+        current = countdown > 0 ? current + step : target;
+        return current;
+    }
+
+    float getCurrentValue() const noexcept { return current; }
+    float getTargetValue() const noexcept { return target; }
+    bool isSmoothing() const noexcept { return countdown > 0; }
+
+private:
+    float current = 0.0f;
+    float target = 0.0f;
+    float step = 0.0f;
+    int countdown = 0;
+    int stepsToTarget = 0;
+};
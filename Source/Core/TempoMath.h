@@ -0,0 +1,53 @@
+/*
+  ==============================================================================
+    TempoMath.h
+    Created: 10 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Note-length to milliseconds conversion for tempo sync, without JUCE.
+    Tempo (the JUCE adapter) reads the BPM from the host's play head and
+    uses this for the math.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "CoreAssert.h"
+
+// Varies note representations below
+// Each is a multiplier expressed in units of quarter-notes (beats)
+// The code computes milliseconds as: ms = 60000.0 * multiplier / bpm.
+// (60000 / bpm = milliseconds per quarter note)
+inline constexpr std::array<double, 16> noteLengthMultipliers =
+{
+    0.125,        //  0 = 1/32 note
+    0.5 / 3.0,    //  1 = 1/16 triplet
+    0.1875,       //  2 = 1/32 dotted
+    0.25,         //  3 = 1/16 note
+    1.0 / 3.0,    //  4 = 1/8 triplet
+    0.375,        //  5 = 1/16 dotted
+    0.5,          //  6 = 1/8 note
+    2.0 / 3.0,    //  7 = 1/4 triplet
+    0.75,         //  8 = 1/8 dotted
+    1.0,          //  9 = 1/4 note
+    4.0 / 3.0,    // 10 = 1/2 triplet
+    1.5,          // 11 = 1/4 dotted
+    2.0,          // 12 = 1/2 note
+    8.0 / 3.0,    // 13 = 1/1 triplet
+    3.0,          // 14 = 1/2 dotted
+    4.0,          // 15 = 1/1 = whole note
+};
+
+// index must be in 0..15 (the Delay Note choices)
+inline double millisecondsForNoteLength(double bpm, int index) noexcept
+{
+    CORE_ASSERT(index >= 0 && index < int(noteLengthMultipliers.size()));
+    return 60000.0 * noteLengthMultipliers[size_t(index)] / bpm;
+}
@@ -0,0 +1,426 @@
+/*
+  ==============================================================================
+    CoreTests.cpp
+    Created: 15 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Test and benchmark for delay_core (DelayCoreTests target in
+    Source/Core/CMakeLists.txt), standard library only like the library:
+     - BatchDelayEngine against a reference built from the single-instance
+       pieces (DelayRing, TptFilter, LinearSmoother), one reference per
+       instance: the outputs must be bit-identical, with several settings
+       slots, a settings change mid-run and in-place buffers,
+     - DelayRing's block reads against per-sample reads,
+     - "Benchmark": throughput of the batch engine vs. the references.
+    Only compiled with DELAY_CORE_TESTS=1, so a build that picks up every
+    file under Source never sees this main().
+
+      DelayCoreTests [Benchmark]
+  ==============================================================================
+*/
+
+#if DELAY_CORE_TESTS
+
+#include "../BatchDelayEngine.h"
+#include "../DelayRing.h"
+#include "../DSP.h"
+#include "../Smoothers.h"
+#include "../TptFilter.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+static int numFailures = 0;
+
+static void expect(bool condition, const char* what)
+{
+    if (!condition) {
+        std::printf("  FAILED: %s\n", what);
+        ++numFailures;
+    }
+}
+
+//==============================================================================
+// One instance of BatchDelayEngine's algorithm, the way the plug-in's per-sample
+// engine builds it: DelayRing write + cubic read, TptFilter low cut / high cut in the
+// feedback path, LinearSmoother ramps and the one-pole delay glide. Control values are
+// stepped per internal block first and the cutoffs applied once per block, as in
+// BatchDelayEngine::processBlock.
+class ReferenceDelay
+{
+public:
+    void prepare(double newSampleRate, float maxDelayTime)
+    {
+        sampleRate = newSampleRate;
+        delayCoeff = 1.0f - std::exp(-1.0f / (0.2f * float(sampleRate)));
+        maxDelayInSamples = int(std::ceil(maxDelayTime / 1000.0 * sampleRate));
+
+        int length = maxDelayInSamples + 4;
+        storageL.assign(size_t(length), 0.0f);
+        storageR.assign(size_t(length), 0.0f);
+        ringL.attach(storageL.data(), length, true);
+        ringR.attach(storageR.data(), length, true);
+        ringL.setLength(length);
+        ringR.setLength(length);
+
+        for (auto* smoother : { &gain, &mix, &feedback, &stereo, &lowCut, &highCut }) {
+            smoother->reset(sampleRate, 0.02);
+        }
+        lowCutFilterL.setType(TptFilter::Type::highpass);
+        lowCutFilterR.setType(TptFilter::Type::highpass);
+        for (auto* filter : { &lowCutFilterL, &lowCutFilterR, &highCutFilterL, &highCutFilterR }) {
+            filter->prepare(sampleRate);
+        }
+        ramps.assign(size_t(BatchDelayEngine::blockSize) * numRamps, 0.0f);
+    }
+
+    // Jump to settings (BatchDelayEngine::setSettings + reset)
+    void reset(const BatchDelayEngine::Settings& newSettings)
+    {
+        settings = newSettings;
+        ringL.markSilent();
+        ringR.markSilent();
+        std::fill(storageL.begin(), storageL.end(), 0.0f);
+        std::fill(storageR.begin(), storageR.end(), 0.0f);
+        for (auto* filter : { &lowCutFilterL, &lowCutFilterR, &highCutFilterL, &highCutFilterR }) {
+            filter->reset();
+        }
+        feedbackL = feedbackR = 0.0f;
+
+        gain.setCurrentAndTargetValue(decibelsToGain(settings.gain));
+        mix.setCurrentAndTargetValue(settings.mix * 0.01f);
+        feedback.setCurrentAndTargetValue(settings.feedback * 0.01f);
+        stereo.setCurrentAndTargetValue(settings.stereo * 0.01f);
+        lowCut.setCurrentAndTargetValue(settings.lowCut);
+        highCut.setCurrentAndTargetValue(settings.highCut);
+        delayTime = settings.delayTime;
+    }
+
+    // New targets (BatchDelayEngine::setSettings)
+    void setSettings(const BatchDelayEngine::Settings& newSettings)
+    {
+        settings = newSettings;
+        gain.setTargetValue(decibelsToGain(settings.gain));
+        mix.setTargetValue(settings.mix * 0.01f);
+        feedback.setTargetValue(settings.feedback * 0.01f);
+        stereo.setTargetValue(settings.stereo * 0.01f);
+        lowCut.setTargetValue(settings.lowCut);
+        highCut.setTargetValue(settings.highCut);
+    }
+
+    void process(const float* inL, const float* inR, float* outL, float* outR, int numSamples)
+    {
+        for (int offset = 0; offset < numSamples; offset += BatchDelayEngine::blockSize) {
+            int n = std::min(BatchDelayEngine::blockSize, numSamples - offset);
+            processBlock(inL + offset, inR + offset, outL + offset, outR + offset, n);
+        }
+    }
+
+private:
+    static float decibelsToGain(float db) noexcept
+    {
+        return db > -100.0f ? std::pow(10.0f, db * 0.05f) : 0.0f;
+    }
+
+    void processBlock(const float* inL, const float* inR, float* outL, float* outR, int numSamples)
+    {
+        constexpr size_t stride = BatchDelayEngine::blockSize;
+        float* delay = ramps.data();
+        float* fb = delay + stride;
+        float* panL = fb + stride;
+        float* panR = panL + stride;
+        float* mixRamp = panR + stride;
+        float* gainRamp = mixRamp + stride;
+
+        float maxDelay = float(maxDelayInSamples);
+        float targetDelay = std::clamp(settings.delayTime, 5.0f, 1000.0f * maxDelay / float(sampleRate));
+        for (int i = 0; i < numSamples; ++i) {
+            delayTime += (targetDelay - delayTime) * delayCoeff;
+            delay[i] = std::min(delayTime / 1000.0f * float(sampleRate), maxDelay);
+            fb[i] = feedback.getNextValue();
+            panningEqualPower(stereo.getNextValue(), panL[i], panR[i]);
+            mixRamp[i] = mix.getNextValue();
+            gainRamp[i] = gain.getNextValue();
+            lowCut.getNextValue();
+            highCut.getNextValue();
+        }
+
+        lowCutFilterL.setCutoffFrequency(lowCut.getCurrentValue());
+        lowCutFilterR.setCutoffFrequency(lowCut.getCurrentValue());
+        highCutFilterL.setCutoffFrequency(highCut.getCurrentValue());
+        highCutFilterR.setCutoffFrequency(highCut.getCurrentValue());
+
+        for (int i = 0; i < numSamples; ++i) {
+            float mono = (inL[i] + inR[i]) * 0.5f;
+            ringL.write(mono * panL[i] + feedbackR);
+            ringR.write(mono * panR[i] + feedbackL);
+
+            float wetL = ringL.read(delay[i]);
+            float wetR = ringR.read(delay[i]);
+            feedbackL = highCutFilterL.processSample(lowCutFilterL.processSample(wetL * fb[i]));
+            feedbackR = highCutFilterR.processSample(lowCutFilterR.processSample(wetR * fb[i]));
+
+            outL[i] = (inL[i] + wetL * mixRamp[i]) * gainRamp[i];
+            outR[i] = (inR[i] + wetR * mixRamp[i]) * gainRamp[i];
+        }
+    }
+
+    static constexpr size_t numRamps = 6;
+
+    double sampleRate = 44100.0;
+    float delayCoeff = 0.0f;
+    int maxDelayInSamples = 0;
+
+    BatchDelayEngine::Settings settings;
+    LinearSmoother gain, mix, feedback, stereo, lowCut, highCut;
+    float delayTime = 0.0f;
+
+    std::vector<float> storageL, storageR;
+    DelayRing ringL, ringR;
+    TptFilter lowCutFilterL, lowCutFilterR, highCutFilterL, highCutFilterR;
+    float feedbackL = 0.0f;
+    float feedbackR = 0.0f;
+    std::vector<float> ramps;
+};
+
+//==============================================================================
+// Test signal for instance m: a sine on the left, clicks on the right (or the same
+// buffer for both sides, as a mono source would pass it)
+static void fillInput(std::vector<float>& left, std::vector<float>& right, int instance)
+{
+    for (size_t i = 0; i < left.size(); ++i) {
+        left[i] = 0.5f * std::sin(float(i) * 0.013f * float(instance + 1));
+        right[i] = (i % 997 == 0) ? 1.0f : 0.0f;
+    }
+}
+
+static void testBatchMatchesReference()
+{
+    std::printf("BatchDelayEngine vs. DelayRing + TptFilter reference\n");
+
+    constexpr double sampleRate = 48000.0;
+    constexpr int numInstances = 11;         // not a multiple of the SIMD width
+    constexpr int numSlots = 3;
+    constexpr int numSamples = 9000;
+
+    BatchDelayEngine::Settings slotSettings[numSlots];
+    slotSettings[0].delayTime = 12.0f;       // shorter than an internal block
+    slotSettings[0].feedback = 70.0f;
+    slotSettings[0].lowCut = 200.0f;
+    slotSettings[0].highCut = 5000.0f;
+    slotSettings[0].stereo = 40.0f;
+    slotSettings[1].delayTime = 33.3f;
+    slotSettings[1].feedback = -55.0f;
+    slotSettings[1].mix = 60.0f;
+    slotSettings[2].delayTime = 250.0f;
+    slotSettings[2].feedback = 90.0f;
+    slotSettings[2].highCut = 3000.0f;
+    slotSettings[2].gain = -3.0f;
+
+    BatchDelayEngine engine;
+    engine.prepare(sampleRate, numInstances, numSlots, 1000.0f);
+    for (int s = 0; s < numSlots; ++s) {
+        engine.setSettings(s, slotSettings[s]);
+    }
+    engine.reset();
+
+    std::vector<ReferenceDelay> references(numInstances);
+    std::vector<std::vector<float>> batchL, batchR, refL, refR;
+    for (int m = 0; m < numInstances; ++m) {
+        engine.assignSettings(m, m % numSlots);
+        references[size_t(m)].prepare(sampleRate, 1000.0f);
+        references[size_t(m)].reset(slotSettings[m % numSlots]);
+
+        batchL.emplace_back(numSamples);
+        batchR.emplace_back(numSamples);
+        fillInput(batchL.back(), batchR.back(), m);
+        refL.push_back(batchL.back());
+        refR.push_back(batchR.back());
+    }
+
+    // two runs with a settings change in between (glides, new cutoffs), with odd
+    // lengths so internal blocks don't line up with the calls; processed in place
+    const int split = 4321;
+    BatchDelayEngine::Settings changed = slotSettings[1];
+    changed.delayTime = 80.0f;
+    changed.lowCut = 500.0f;
+    changed.highCut = 2500.0f;
+    changed.stereo = -70.0f;
+    changed.gain = -6.0f;
+
+    for (int run = 0; run < 2; ++run) {
+        int offset = run == 0 ? 0 : split;
+        int length = run == 0 ? split : numSamples - split;
+        if (run == 1) {
+            engine.setSettings(1, changed);
+        }
+
+        std::vector<float*> pointersL, pointersR;
+        for (int m = 0; m < numInstances; ++m) {
+            pointersL.push_back(batchL[size_t(m)].data() + offset);
+            pointersR.push_back(batchR[size_t(m)].data() + offset);
+        }
+        engine.process(pointersL.data(), pointersR.data(), pointersL.data(), pointersR.data(), length);
+
+        for (int m = 0; m < numInstances; ++m) {
+            auto& reference = references[size_t(m)];
+            if (run == 1 && m % numSlots == 1) {
+                reference.setSettings(changed);
+            }
+            float* l = refL[size_t(m)].data() + offset;
+            float* r = refR[size_t(m)].data() + offset;
+            reference.process(l, r, l, r, length);
+        }
+    }
+
+    bool identical = true;
+    float largestDifference = 0.0f;
+    bool hasSignal = false;
+    for (int m = 0; m < numInstances; ++m) {
+        for (int i = 0; i < numSamples; ++i) {
+            float dl = std::fabs(batchL[size_t(m)][size_t(i)] - refL[size_t(m)][size_t(i)]);
+            float dr = std::fabs(batchR[size_t(m)][size_t(i)] - refR[size_t(m)][size_t(i)]);
+            largestDifference = std::max(largestDifference, std::max(dl, dr));
+            identical = identical
+                && std::memcmp(&batchL[size_t(m)][size_t(i)], &refL[size_t(m)][size_t(i)], sizeof(float)) == 0
+                && std::memcmp(&batchR[size_t(m)][size_t(i)], &refR[size_t(m)][size_t(i)], sizeof(float)) == 0;
+            hasSignal = hasSignal || std::fabs(batchR[size_t(m)][size_t(i)]) > 1.0e-3f;
+        }
+    }
+    std::printf("  largest difference %g\n", double(largestDifference));
+    expect(hasSignal, "batch output is not silent");
+    expect(identical, "batch output is bit-identical to the reference");
+}
+
+//==============================================================================
+static void testRingBlockReads()
+{
+    std::printf("DelayRing block reads vs. per-sample reads\n");
+
+    constexpr int length = 1024;
+    constexpr int numSamples = 64;
+    std::vector<float> storageA(length), storageB(length);
+    DelayRing a, b;
+    a.attach(storageA.data(), length, true);
+    b.attach(storageB.data(), length, true);
+    a.setLength(length);
+    b.setLength(length);
+    a.markSilent();
+    b.markSilent();
+
+    // fill both with the same history, crossing the end of the buffer
+    for (int i = 0; i < length + 300; ++i) {
+        float x = std::sin(float(i) * 0.07f);
+        a.write(x);
+        b.write(x);
+    }
+
+    std::vector<float> delays(numSamples), input(numSamples), blockOut(numSamples), sampleOut(numSamples);
+    for (int i = 0; i < numSamples; ++i) {
+        delays[size_t(i)] = 400.0f + 3.7f * float(i);
+        input[size_t(i)] = float(i) * 0.01f;
+    }
+
+    for (int pass = 0; pass < 2; ++pass) {
+        bool constant = pass == 1;
+        if (constant) {
+            a.readBlock(700.25f, blockOut.data(), numSamples);
+        } else {
+            a.readBlock(delays.data(), blockOut.data(), numSamples);
+        }
+        a.writeBlock(input.data(), numSamples);
+
+        for (int i = 0; i < numSamples; ++i) {
+            b.write(input[size_t(i)]);
+            sampleOut[size_t(i)] = b.read(constant ? 700.25f : delays[size_t(i)]);
+        }
+        expect(blockOut == sampleOut, constant ? "constant-delay readBlock matches read()"
+                                               : "ramped readBlock matches read()");
+    }
+}
+
+//==============================================================================
+// Seconds of audio processed per second of CPU, batch engine vs. one reference per
+// instance (both single-threaded, 48 kHz, 512-sample calls)
+static void benchmark()
+{
+    constexpr double sampleRate = 48000.0;
+    constexpr int blockSize = 512;
+    constexpr int numBlocks = 200;
+
+    for (int numInstances : { 16, 256, 1024 }) {
+        BatchDelayEngine::Settings settings;
+        settings.delayTime = 375.0f;
+        settings.feedback = 60.0f;
+        settings.lowCut = 100.0f;
+        settings.highCut = 8000.0f;
+
+        BatchDelayEngine engine;
+        engine.prepare(sampleRate, numInstances, 1, 1000.0f);
+        engine.setSettings(0, settings);
+        engine.reset();
+
+        std::vector<ReferenceDelay> references(static_cast<size_t>(numInstances));
+        for (auto& reference : references) {
+            reference.prepare(sampleRate, 1000.0f);
+            reference.reset(settings);
+        }
+
+        std::vector<std::vector<float>> left, right;
+        std::vector<float*> pointersL, pointersR;
+        for (int m = 0; m < numInstances; ++m) {
+            left.emplace_back(blockSize);
+            right.emplace_back(blockSize);
+            fillInput(left.back(), right.back(), m);
+            pointersL.push_back(left.back().data());
+            pointersR.push_back(right.back().data());
+        }
+
+        using Clock = std::chrono::steady_clock;
+        auto start = Clock::now();
+        for (int k = 0; k < numBlocks; ++k) {
+            engine.process(pointersL.data(), pointersR.data(), pointersL.data(), pointersR.data(), blockSize);
+        }
+        double batchSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        start = Clock::now();
+        for (int k = 0; k < numBlocks; ++k) {
+            for (int m = 0; m < numInstances; ++m) {
+                references[size_t(m)].process(pointersL[size_t(m)], pointersR[size_t(m)],
+                                              pointersL[size_t(m)], pointersR[size_t(m)], blockSize);
+            }
+        }
+        double referenceSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+        double audioSeconds = double(numBlocks) * blockSize / sampleRate * numInstances;
+        std::printf("%5d instances: batch %8.1fx real time, reference %8.1fx real time (%.2fx)\n",
+                    numInstances, audioSeconds / batchSeconds, audioSeconds / referenceSeconds,
+                    referenceSeconds / batchSeconds);
+    }
+}
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    if (argc > 1 && std::strcmp(argv[1], "Benchmark") == 0) {
+        benchmark();
+        return 0;
+    }
+
+    testBatchMatchesReference();
+    testRingBlockReads();
+
+    std::printf(numFailures == 0 ? "All tests passed\n" : "%d test(s) failed\n", numFailures);
+    return numFailures == 0 ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,117 @@
+/*
+  ==============================================================================
+    TptFilter.h
+    Created: 10 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    2-pole TPT (topology-preserving transform) state variable filter, the
+    same structure and default resonance (1 / sqrt 2, no peak) as
+    juce::dsp::StateVariableTPTFilter, without JUCE. The coefficients are
+    computed in double and rounded to float exactly like
+    StateVariableTPTFilter::update, so both filters give the same samples.
+    Header-only:
+     - TptCoefficients / tptTick: the raw step, for code that keeps its
+       filter states in arrays (one lane per voice or instance),
+     - TptFilter: one mono filter with a fixed output type, for the delay's
+       feedback path.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cmath>
+#include "CoreAssert.h"
+
+struct TptCoefficients
+{
+    float g = 0.0f;     // tan(pi * cutoff / sampleRate)
+    float R2 = 0.0f;    // 1 / resonance
+    float h = 0.0f;     // 1 / (1 + R2 * g + g * g)
+};
+
+inline TptCoefficients makeTptCoefficients(float cutoff, double sampleRate) noexcept
+{
+    CORE_ASSERT(cutoff > 0.0f && sampleRate > 0.0);
+
+    constexpr double pi = 3.141592653589793238;
+    cutoff = std::fmin(cutoff, float(0.49 * sampleRate));     // keep tan() finite
+
+    // same expressions and roundings as StateVariableTPTFilter::update (float samples):
+    // g and 1 / resonance in double, h from the float g / R2 summed in double
+    const float resonance = float(1.0 / std::sqrt(2.0));
+
+    TptCoefficients c;
+    c.g = float(std::tan(pi * double(cutoff) / sampleRate));
+    c.R2 = float(1.0 / double(resonance));
+    c.h = float(1.0 / (1.0 + double(c.R2 * c.g) + double(c.g * c.g)));
+    return c;
+}
+
+struct TptOutputs
+{
+    float lowpass;
+    float bandpass;
+    float highpass;
+};
+
+// One sample through the filter with states s1 / s2 (updated in place).
+inline TptOutputs tptTick(float x, float g, float R2, float h, float& s1, float& s2) noexcept
+{
+    float highpass = h * (x - (R2 + g) * s1 - s2);
+    float bandpass = highpass * g + s1;
+    s1 = highpass * g + bandpass;
+    float lowpass = bandpass * g + s2;
+    s2 = bandpass * g + lowpass;
+    return { lowpass, bandpass, highpass };
+}
+
+class TptFilter
+{
+public:
+    enum class Type { lowpass, bandpass, highpass };
+
+    void setType(Type newType) noexcept { type = newType; }
+
+    void prepare(double newSampleRate) noexcept
+    {
+        sampleRate = newSampleRate;
+        coefficients = makeTptCoefficients(cutoff, sampleRate);
+        reset();
+    }
+
+    void setCutoffFrequency(float newCutoff) noexcept
+    {
+        cutoff = newCutoff;
+        coefficients = makeTptCoefficients(cutoff, sampleRate);
+    }
+
+    void reset() noexcept
+    {
+        s1 = 0.0f;
+        s2 = 0.0f;
+    }
+
+    float processSample(float x) noexcept
+    {
+        auto y = tptTick(x, coefficients.g, coefficients.R2, coefficients.h, s1, s2);
+        switch (type) {
+            case Type::lowpass:  return y.lowpass;
+            case Type::bandpass: return y.bandpass;
+            case Type::highpass: return y.highpass;
+        }
+        return y.lowpass;
+    }
+
+private:
+    Type type = Type::lowpass;
+    double sampleRate = 44100.0;
+    float cutoff = 1000.0f;
+    TptCoefficients coefficients = makeTptCoefficients(1000.0f, 44100.0);
+    float s1 = 0.0f;
+    float s2 = 0.0f;
+};
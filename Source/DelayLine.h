@@ -7,40 +7,84 @@
               UMass Dartmouth
               Graduate Computer Science Dept
               Spring 2026
+
+     Note:
+     JUCE adapter around the core DelayRing (Source/Core): DelayLine owns the
+     sample memory, borrowed from the shared BufferPool, and forwards the
+     delay itself to the ring.
   ==============================================================================
 */
 
 #pragma once    // include guard: ensure this header is included only once
 
-#include <memory>   // for std::unique_ptr used to own the circular buffer
+#include <JuceHeader.h>
+#include "BufferPool.h"   // shared, recycled sample memory
+#include "Core/DelayRing.h" // circular buffer + cubic read (no JUCE)
 
 // Simple circular delay buffer class (mono) providing write and fractional-read access.
 class DelayLine
 {
 public:
-    // Allocate or resize the internal buffer to hold at least maxLengthInSamples samples.
-    // Typically called from prepareToPlay with sampleRate * maxDelaySeconds.
+    // Make sure the buffer can hold maxLengthInSamples without allocating later, e.g. for
+    // the highest sample rate a host is expected to use. The memory comes from the
+    // process-wide BufferPool; only the active length (setMaximumDelayInSamples) is
+    // backed by physical memory.
+    void reserve(int maxLengthInSamples);
+
+    // Set the active buffer length to hold maxLengthInSamples samples. Typically called
+    // from prepareToPlay with sampleRate * maxDelaySeconds. Only allocates if that is more
+    // than was reserved. Prefaults the active part the first time it is used.
     void setMaximumDelayInSamples(int maxLengthInSamples);
 
-    // Clear the buffer and reset indices (safe to call from real-time code).
+    // Give the buffer back to the pool (releaseResources). Call setMaximumDelayInSamples
+    // and reset again before the next write / read.
+    void release();
+
+    // Clear the buffer and reset indices. Only the part written since the last reset
+    // is cleared (see DelayRing::getDirtyLength / DelayRing::reset), so a reset after a
+    // short run is nearly free.
     void reset() noexcept;
 
     // Write a sample into the delay buffer at the current write position and advance the index.
     // Should be real-time safe (no allocations).
-    void write(float input) noexcept;
+    void write(float input) noexcept { ring.write(input); }
 
     // Read a delayed sample. delayInSamples can be fractional (implementation typically
     // does linear or higher-order interpolation). The method is const and real-time safe.
-    float read(float delayInSamples) const noexcept;
+    float read(float delayInSamples) const noexcept { return ring.read(delayInSamples); }
+
+    // Block read for when none of the next numSamples writes has happened yet:
+    // output[i] is what read(delays[i]) returns after i + 1 more write() calls.
+    // Requires delays[i] >= numSamples + 1 for every i, so nothing read is still to be
+    // written. Doesn't change the delay line, so channels can be read concurrently.
+    void readBlock(const float* delays, float* output, int numSamples) const noexcept
+    {
+        ring.readBlock(delays, output, numSamples);
+    }
+
+    // Same for a delay that is constant over the block (the usual case once the delay
+    // smoother has settled). Runs as contiguous, vectorizable interpolation passes.
+    void readBlock(float delayInSamples, float* output, int numSamples) const noexcept
+    {
+        ring.readBlock(delayInSamples, output, numSamples);
+    }
+
+    // Same as numSamples calls to write(), done as (at most two) block copies.
+    void writeBlock(const float* input, int numSamples) noexcept
+    {
+        ring.writeBlock(input, numSamples);
+    }
 
-    // Return the current buffer length in samples (capacity).
+    // Return the current (active) buffer length in samples.
     int getBufferLength() const noexcept
     {
-        return bufferLength;
+        return ring.getLength();
     }
 
 private:
-    std::unique_ptr<float[]> buffer; // owned raw float array for the circular buffer
-    int bufferLength = 0;            // capacity of the buffer in samples
-    int writeIndex = 0;              // index where the most recent value was written (next write will overwrite at this pos)
+    juce::SharedResourcePointer<BufferPool> pool; // declared first: outlives the buffer below
+    BufferPool::Buffer buffer;       // pooled float array for the circular buffer
+    int capacity = 0;                // samples the buffer can hold (reserved)
+    int prefaultedLength = 0;        // samples from the start already backed by memory
+    DelayRing ring;                  // the delay itself, on buffer's memory
 };
@@ -0,0 +1,110 @@
+/*
+  ==============================================================================
+    EchoVisualizer.cpp
+    Created: 9 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    - Each frame, pops whatever the audio thread published and appends it to
+      a fixed-size history ring (no allocation on the message thread).
+    - The outline path is rebuilt only when new frames arrived; otherwise
+      paint() just fills the cached path.
+    - Repeat markers are drawn every delayTime ms back from "now" (right edge)
+      and fade with the feedback amount, like the echoes themselves.
+  ==============================================================================
+*/
+
+#include "EchoVisualizer.h"
+#include "LookAndFeel.h"    // colours
+
+EchoVisualizer::EchoVisualizer(EnvelopeFifo& envelope_,
+                               const std::atomic<float>& delayTime_,
+                               const std::atomic<float>& feedback_)
+    : envelope(envelope_), delayTime(delayTime_), feedback(feedback_)
+{
+    setOpaque(true);
+}
+
+void EchoVisualizer::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+
+    g.fillAll(Colors::EchoVisualizer::background);
+
+    // zero line
+    g.setColour(Colors::EchoVisualizer::marker.withAlpha(0.3f));
+    g.fillRect(bounds.withHeight(1.0f).withCentre(bounds.getCentre()));
+
+    // one marker per feedback repeat, newest echo at the right edge
+    float delayMs = delayTime.load();
+    if (delayMs > 0.0f) {
+        float spacing = bounds.getWidth() * delayMs / (historySeconds * 1000.0f);
+        float gainPerRepeat = std::abs(feedback.load());
+        float alpha = 1.0f;
+        for (float x = bounds.getRight() - spacing; x > bounds.getX() && alpha > 0.05f; x -= spacing) {
+            g.setColour(Colors::EchoVisualizer::marker.withAlpha(alpha));
+            g.fillRect(x, bounds.getY(), 1.0f, bounds.getHeight());
+            alpha *= gainPerRepeat;
+        }
+    }
+
+    g.setColour(Colors::EchoVisualizer::waveform);
+    g.fillPath(waveform);
+}
+
+void EchoVisualizer::resized()
+{
+    rebuildPath(); // path is in component coordinates
+}
+
+void EchoVisualizer::refresh()
+{
+    int numFrames = envelope.pop(incoming.data(), int(incoming.size()));
+    if (numFrames == 0) {
+        return; // nothing new: keep the cached path and skip the repaint
+    }
+
+    for (int i = 0; i < numFrames; ++i) {
+        history[size_t(historyIndex)] = incoming[size_t(i)];
+        historyIndex = (historyIndex + 1) % historyLength;
+    }
+
+    rebuildPath();
+    repaint();
+}
+
+// Build a closed outline: along the maxima from oldest to newest, then back along the minima.
+void EchoVisualizer::rebuildPath()
+{
+    auto bounds = getLocalBounds().toFloat();
+    float xStep = bounds.getWidth() / float(historyLength - 1);
+    float centreY = bounds.getCentreY();
+    float halfHeight = bounds.getHeight() * 0.5f;
+
+    auto yForSample = [=](float sample)
+    {
+        return centreY - juce::jlimit(-1.0f, 1.0f, sample) * halfHeight;
+    };
+
+    waveform.clear();
+    waveform.preallocateSpace(historyLength * 2 * 3 + 8);
+
+    for (int i = 0; i < historyLength; ++i) {
+        const auto& frame = history[size_t((historyIndex + i) % historyLength)];
+        float x = bounds.getX() + float(i) * xStep;
+        if (i == 0) {
+            waveform.startNewSubPath(x, yForSample(frame.max));
+        } else {
+            waveform.lineTo(x, yForSample(frame.max));
+        }
+    }
+    for (int i = historyLength; --i >= 0;) {
+        const auto& frame = history[size_t((historyIndex + i) % historyLength)];
+        waveform.lineTo(bounds.getX() + float(i) * xStep, yForSample(frame.min));
+    }
+    waveform.closeSubPath();
+}
@@ -0,0 +1,58 @@
+/*
+  ==============================================================================
+    EchoVisualizer.h
+    Created: 9 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Scrolling view of the wet signal (the echo train) with a marker at
+    every feedback repeat. Fed by the processor's EnvelopeFifo; it never
+    touches the DelayLine buffers.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "EnvelopeFifo.h"       // decimated min/max frames from the audio thread
+#include "RefreshScheduler.h"   // shared per-frame UI clock
+
+class EchoVisualizer : public juce::Component
+{
+public:
+    // envelope: wet-signal frames written by the audio thread
+    // delayTime: current delay time in ms (published by the processor once per block)
+    // feedback: current feedback amount -1..1 (used to fade the repeat markers)
+    EchoVisualizer(EnvelopeFifo& envelope,
+                   const std::atomic<float>& delayTime,
+                   const std::atomic<float>& feedback);
+
+    void paint(juce::Graphics&) override;
+    void resized() override;
+
+private:
+    void refresh();       // per-frame: drain the fifo and rebuild the path if needed
+    void rebuildPath();   // turn the history ring into a filled min/max outline
+
+    static constexpr float historySeconds = 4.0f; // visible time span
+    static constexpr int historyLength = int(historySeconds * EnvelopeFifo::framesPerSecond);
+
+    EnvelopeFifo& envelope;
+    const std::atomic<float>& delayTime;
+    const std::atomic<float>& feedback;
+
+    std::array<EnvelopeFrame, historyLength> history {}; // ring of the most recent frames
+    int historyIndex = 0;                                 // next slot to overwrite (= oldest frame)
+
+    std::array<EnvelopeFrame, EnvelopeFifo::capacity> incoming; // scratch for fifo reads
+
+    juce::Path waveform;  // cached outline, only rebuilt when new frames arrived
+
+    // Per-frame updates driven by the shared scheduler (declared last: it calls refresh())
+    RefreshScheduler::Attachment refreshAttachment { *this, [this] { refresh(); } };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (EchoVisualizer)
+};
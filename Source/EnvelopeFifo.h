@@ -0,0 +1,104 @@
+/*
+  ==============================================================================
+    EnvelopeFifo.h
+    Created: 9 Mar 2026
+    Author:  Michael Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:   header-only, single-producer / single-consumer ring of decimated
+            min/max frames. The audio thread folds samples into the current
+            frame and publishes finished frames once per block; the UI thread
+            pops them for drawing. Built on juce::AbstractFifo, so neither
+            side ever locks or allocates.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// One decimated frame of the signal: the lowest and highest sample it covered.
+struct EnvelopeFrame
+{
+    float min = 0.0f;
+    float max = 0.0f;
+};
+
+class EnvelopeFifo
+{
+public:
+    static constexpr int framesPerSecond = 200; // envelope resolution (5 ms per frame)
+    static constexpr int capacity = 1024;       // ~5 s of frames if the UI stalls
+
+    // Set the decimation factor for the sample rate and drop any unread frames.
+    // Call from prepareToPlay (not concurrently with pop()).
+    void prepare(double sampleRate) noexcept
+    {
+        samplesPerFrame = juce::jmax(1, int(sampleRate / framesPerSecond));
+        sampleCount = 0;
+        numPending = 0;
+        current = {};
+        fifo.reset();
+    }
+
+    // Audio thread: fold one sample into the current frame.
+    void pushSample(float sample) noexcept
+    {
+        if (sampleCount == 0) {
+            current.min = sample;
+            current.max = sample;
+        } else {
+            current.min = std::min(current.min, sample);
+            current.max = std::max(current.max, sample);
+        }
+
+        if (++sampleCount == samplesPerFrame) {
+            pending[size_t(numPending++)] = current;
+            sampleCount = 0;
+            if (numPending == int(pending.size())) { // very large block: publish early
+                flush();
+            }
+        }
+    }
+
+    // Audio thread: publish the frames completed during this block in one write.
+    // Frames that don't fit because the UI isn't reading are dropped.
+    void flush() noexcept
+    {
+        const auto scope = fifo.write(numPending);
+        for (int i = 0; i < scope.blockSize1; ++i) {
+            frames[size_t(scope.startIndex1 + i)] = pending[size_t(i)];
+        }
+        for (int i = 0; i < scope.blockSize2; ++i) {
+            frames[size_t(scope.startIndex2 + i)] = pending[size_t(scope.blockSize1 + i)];
+        }
+        numPending = 0;
+    }
+
+    // UI thread: copy up to maxFrames published frames into dest, oldest first.
+    int pop(EnvelopeFrame* dest, int maxFrames) noexcept
+    {
+        const auto scope = fifo.read(maxFrames);
+        for (int i = 0; i < scope.blockSize1; ++i) {
+            dest[i] = frames[size_t(scope.startIndex1 + i)];
+        }
+        for (int i = 0; i < scope.blockSize2; ++i) {
+            dest[scope.blockSize1 + i] = frames[size_t(scope.startIndex2 + i)];
+        }
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+private:
+    juce::AbstractFifo fifo { capacity };
+    std::array<EnvelopeFrame, capacity> frames;  // ring storage shared by both threads
+
+    // Audio-thread-only state
+    std::array<EnvelopeFrame, 64> pending;       // frames finished in the current block
+    int numPending = 0;
+    EnvelopeFrame current;                       // frame being accumulated
+    int sampleCount = 0;                         // samples folded into current so far
+    int samplesPerFrame = 240;                   // decimation factor (48 kHz default)
+};
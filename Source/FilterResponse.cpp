@@ -0,0 +1,89 @@
+/*
+  ==============================================================================
+    FilterResponse.cpp
+    Created: 23 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    The per-point math is done over whole arrays: the ratio scaling uses
+    FloatVectorOperations and the power formula is a branch-free loop over
+    aligned arrays that the compiler vectorizes. Only the final dB
+    conversion and path building are scalar, and all of it only runs
+    when a cutoff (or the sample rate) actually changed.
+  ==============================================================================
+*/
+
+#include "FilterResponse.h"
+
+bool FilterResponse::update(float lowCut, float highCut, double sampleRate)
+{
+    if (sampleRate <= 0.0) {
+        return false;
+    }
+    if (lowCut == lastLowCut && highCut == lastHighCut && sampleRate == lastSampleRate) {
+        return false; // nothing changed: keep the cached path
+    }
+
+    if (sampleRate != lastSampleRate) {
+        prepareFrequencies(sampleRate);
+    }
+    lastLowCut = lowCut;
+    lastHighCut = highCut;
+
+    auto warp = [sampleRate](float hz)
+    {
+        float nyquistSafe = std::min(hz, float(sampleRate) * 0.49f);
+        return std::tan(juce::MathConstants<float>::pi * nyquistSafe / float(sampleRate));
+    };
+
+    // r = warped frequency / warped cutoff, for both filters at once per array
+    juce::FloatVectorOperations::multiply(rLow.data(), warped.data(), 1.0f / warp(lowCut), numPoints);
+    juce::FloatVectorOperations::multiply(rHigh.data(), warped.data(), 1.0f / warp(highCut), numPoints);
+
+    // |HP|^2 * |LP|^2 = rl^4 / ((1 + rl^4) * (1 + rh^4))
+    const float* rl = rLow.data();
+    const float* rh = rHigh.data();
+    float* out = power.data();
+    for (int i = 0; i < numPoints; ++i) {
+        float rl2 = rl[i] * rl[i];
+        float rh2 = rh[i] * rh[i];
+        float rl4 = rl2 * rl2;
+        float rh4 = rh2 * rh2;
+        out[i] = rl4 / ((1.0f + rl4) * (1.0f + rh4));
+    }
+
+    // Power -> dB -> unit-square path (same mapping as the analyzer)
+    const float mindB = SpectrumAnalyzer::mindB;
+    const float maxdB = SpectrumAnalyzer::maxdB;
+    const float minPower = std::pow(10.0f, mindB / 10.0f); // power floor for mindB
+
+    path.clear();
+    path.preallocateSpace(numPoints * 3 + 4);
+    for (int i = 0; i < numPoints; ++i) {
+        float db = 10.0f * std::log10(std::max(power[size_t(i)], minPower));
+        float x = float(i) / float(numPoints - 1);
+        float y = juce::jmap(juce::jlimit(mindB, maxdB, db), mindB, maxdB, 1.0f, 0.0f);
+        if (i == 0) {
+            path.startNewSubPath(x, y);
+        } else {
+            path.lineTo(x, y);
+        }
+    }
+    return true;
+}
+
+// Display frequencies are log-spaced 20 Hz .. 20 kHz, exactly like the analyzer points.
+void FilterResponse::prepareFrequencies(double sampleRate)
+{
+    lastSampleRate = sampleRate;
+
+    float maxHz = float(sampleRate) * 0.49f; // stay below Nyquist where tan() blows up
+    for (int i = 0; i < numPoints; ++i) {
+        float hz = std::min(20.0f * std::pow(1000.0f, float(i) / float(numPoints - 1)), maxHz);
+        warped[size_t(i)] = std::tan(juce::MathConstants<float>::pi * hz / float(sampleRate));
+    }
+}
@@ -0,0 +1,55 @@
+/*
+  ==============================================================================
+    FilterResponse.h
+    Created: 23 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Magnitude response of the feedback-path tone filters (Low Cut highpass +
+    High Cut lowpass) evaluated analytically, for drawing in the Feedback group.
+    Both filters are juce::dsp::StateVariableTPTFilter with the default
+    resonance 1/sqrt(2), i.e. 2nd-order Butterworth sections. With the TPT
+    (bilinear, prewarped) design the exact digital response is
+        |HP|^2 = r^4 / (1 + r^4),  |LP|^2 = 1 / (1 + r^4)
+    where r = tan(pi f / fs) / tan(pi fc / fs).
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SpectrumAnalyzer.h"   // shares the analyzer's frequency / dB axes
+
+class FilterResponse
+{
+public:
+    static constexpr int numPoints = SpectrumAnalyzer::numPoints; // same log-frequency grid
+
+    // Recompute the curve if any input changed since the last call.
+    // Returns true if the cached path was rebuilt.
+    bool update(float lowCut, float highCut, double sampleRate);
+
+    // Response curve in a unit square, on the same axes as SpectrumAnalyzer's paths.
+    const juce::Path& getPath() const noexcept
+    {
+        return path;
+    }
+
+private:
+    void prepareFrequencies(double sampleRate); // per sample rate: tan(pi f / fs) per point
+
+    alignas(16) std::array<float, numPoints> warped {}; // prewarped display frequencies
+    alignas(16) std::array<float, numPoints> power {};  // combined |H|^2 per point
+    alignas(16) std::array<float, numPoints> rLow {};   // scratch: r for the highpass
+    alignas(16) std::array<float, numPoints> rHigh {};  // scratch: r for the lowpass
+
+    float lastLowCut = -1.0f;
+    float lastHighCut = -1.0f;
+    double lastSampleRate = 0.0;
+
+    juce::Path path; // cached between parameter changes
+};
@@ -0,0 +1,147 @@
+/*
+  ==============================================================================
+    ImpulseLibrary.cpp
+    Created: 6 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Generates the Color impulse responses and their partition spectra. All of
+    this runs once per character and sample rate on the message thread; the
+    audio thread only ever sees the finished, read-only Spectra.
+  ==============================================================================
+*/
+
+#include "ImpulseLibrary.h"
+
+std::shared_ptr<const ImpulseLibrary::Spectra> ImpulseLibrary::get(int character, double sampleRate)
+{
+    jassert(character >= 0 && character < numCharacters);
+
+    const juce::ScopedLock sl(lock);
+
+    auto key = std::make_pair(character, juce::roundToInt(sampleRate));
+    auto& entry = cache[key];
+    if (entry == nullptr) {
+        auto impulse = character == tape ? makeTape(sampleRate) : makeSpring(sampleRate);
+        normalise(impulse);
+        entry = makeSpectra(impulse);
+    }
+    return entry;
+}
+
+// Tape: two cascaded one-pole low-passes at 7 kHz (head / gap losses) plus a faint
+// copy 0.5 ms later (smear). About 4 ms long.
+std::vector<float> ImpulseLibrary::makeTape(double sampleRate)
+{
+    int length = juce::jmax(blockSize, juce::roundToInt(0.004 * sampleRate));
+    std::vector<float> impulse(size_t(length), 0.0f);
+
+    float c = 1.0f - std::exp(-juce::MathConstants<float>::twoPi * 7000.0f / float(sampleRate));
+    int smear = juce::roundToInt(0.0005 * sampleRate);
+
+    float stage1 = 0.0f, stage2 = 0.0f;
+    for (int n = 0; n < length; ++n) {
+        float x = (n == 0 ? 1.0f : 0.0f) + (n == smear ? 0.1f : 0.0f);
+        stage1 += c * (x - stage1);
+        stage2 += c * (stage1 - stage2);
+        impulse[size_t(n)] = stage2;
+    }
+    return impulse;
+}
+
+// Spring: an impulse circulating in a 32 ms loop through 32 first-order all-passes
+// (dispersion: high frequencies arrive first, the typical chirp), a 4 kHz low-pass and
+// a loop gain of 0.55. Blended with the direct sound; 150 ms with a fade-out at the end.
+std::vector<float> ImpulseLibrary::makeSpring(double sampleRate)
+{
+    int length = juce::roundToInt(0.15 * sampleRate);
+    std::vector<float> impulse(size_t(length), 0.0f);
+
+    constexpr int numAllpasses = 32;
+    constexpr float allpassCoefficient = 0.55f;
+    constexpr float loopGain = 0.55f;
+    constexpr float directLevel = 0.7f;
+    constexpr float springLevel = 0.5f;
+
+    std::vector<float> loop(size_t(juce::roundToInt(0.032 * sampleRate)), 0.0f);
+    std::array<float, numAllpasses> x1 {}, y1 {};
+    float c = 1.0f - std::exp(-juce::MathConstants<float>::twoPi * 4000.0f / float(sampleRate));
+    float lowpass = 0.0f;
+
+    for (int n = 0; n < length; ++n) {
+        auto& slot = loop[size_t(n) % loop.size()];
+        float v = (n == 0 ? 1.0f : 0.0f) + loopGain * slot;
+
+        for (size_t m = 0; m < size_t(numAllpasses); ++m) { // H(z) = (a + z^-1) / (1 + a z^-1)
+            float y = allpassCoefficient * v + x1[m] - allpassCoefficient * y1[m];
+            x1[m] = v;
+            y1[m] = y;
+            v = y;
+        }
+        lowpass += c * (v - lowpass);
+
+        slot = lowpass;                                   // back into the loop
+        impulse[size_t(n)] = springLevel * lowpass;
+    }
+    impulse[0] += directLevel;
+
+    // fade out the last 20 ms so the truncation doesn't click
+    int fade = juce::jmin(length, juce::roundToInt(0.02 * sampleRate));
+    for (int n = 0; n < fade; ++n) {
+        impulse[size_t(length - 1 - n)] *= 0.5f - 0.5f * std::cos(juce::MathConstants<float>::pi * float(n) / float(fade));
+    }
+    return impulse;
+}
+
+// Scale to a peak magnitude response of 1, measured with one FFT over the whole response.
+void ImpulseLibrary::normalise(std::vector<float>& impulse)
+{
+    int order = 1;
+    while ((1 << order) < int(impulse.size())) {
+        ++order;
+    }
+    juce::dsp::FFT fft(order);
+
+    std::vector<float> data(size_t(2 << order), 0.0f);
+    std::copy(impulse.begin(), impulse.end(), data.begin());
+    fft.performFrequencyOnlyForwardTransform(data.data(), true);
+
+    float peak = *std::max_element(data.begin(), data.begin() + (1 << (order - 1)) + 1);
+    if (peak > 0.0f) {
+        for (auto& sample : impulse) {
+            sample /= peak;
+        }
+    }
+}
+
+// Cut the response into blockSize partitions and transform each one, zero-padded to
+// fftSize (overlap-save).
+std::shared_ptr<const ImpulseLibrary::Spectra> ImpulseLibrary::makeSpectra(const std::vector<float>& impulse)
+{
+    auto spectra = std::make_shared<Spectra>();
+    spectra->numPartitions = (int(impulse.size()) + blockSize - 1) / blockSize;
+    spectra->re.resize(size_t(spectra->numPartitions * numBins));
+    spectra->im.resize(size_t(spectra->numPartitions * numBins));
+
+    juce::dsp::FFT fft(fftOrder);
+    std::array<float, 2 * fftSize> data;
+
+    for (int p = 0; p < spectra->numPartitions; ++p) {
+        data.fill(0.0f);
+        int start = p * blockSize;
+        int count = juce::jmin(blockSize, int(impulse.size()) - start);
+        std::copy(impulse.begin() + start, impulse.begin() + start + count, data.begin());
+
+        fft.performRealOnlyForwardTransform(data.data(), true);
+
+        for (int k = 0; k < numBins; ++k) {
+            spectra->re[size_t(p * numBins + k)] = data[size_t(2 * k)];
+            spectra->im[size_t(p * numBins + k)] = data[size_t(2 * k + 1)];
+        }
+    }
+    return spectra;
+}
@@ -0,0 +1,64 @@
+/*
+  ==============================================================================
+    ImpulseLibrary.h
+    Created: 6 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Process-wide store of the impulse responses used by the Color stage
+    (PartitionedConvolver). The responses are embedded as small generators
+    rather than audio files, so they exist at every sample rate without
+    resampling:
+     - Tape:   high-frequency loss of the playback head plus a faint smear,
+     - Spring: a dispersive spring (all-pass chain in a feedback loop, the
+               usual "chirp" model) blended with the direct sound.
+    Each response is normalised to a peak gain of 1 (0 dB) so it can sit in the
+    feedback loop without raising the loop gain. get() returns the partition
+    spectra, computed once per character and sample rate and shared by every
+    convolver in the process. Call it from prepareToPlay, not the audio thread.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class ImpulseLibrary
+{
+public:
+    // Partition layout shared with PartitionedConvolver
+    static constexpr int blockSize = 64;                 // partition length (samples)
+    static constexpr int fftOrder = 7;
+    static constexpr int fftSize = 1 << fftOrder;        // 2 * blockSize (overlap-save)
+    static constexpr int numBins = fftSize / 2 + 1;      // non-negative frequencies
+
+    enum Character { tape, spring, numCharacters };
+
+    // Partition spectra in split-complex form: re / im of bin k of partition p are at
+    // [p * numBins + k], so the multiply-accumulate loops run over plain float arrays.
+    struct Spectra
+    {
+        int numPartitions = 0;
+        std::vector<float> re;
+        std::vector<float> im;
+    };
+
+    ImpulseLibrary() = default;                          // public so SharedResourcePointer can create it
+
+    std::shared_ptr<const Spectra> get(int character, double sampleRate);
+
+private:
+    static std::vector<float> makeTape(double sampleRate);
+    static std::vector<float> makeSpring(double sampleRate);
+    static void normalise(std::vector<float>& impulse);
+    static std::shared_ptr<const Spectra> makeSpectra(const std::vector<float>& impulse);
+
+    juce::CriticalSection lock;
+    std::map<std::pair<int, int>, std::shared_ptr<const Spectra>> cache; // (character, rate in Hz)
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ImpulseLibrary)
+};
@@ -8,10 +8,11 @@
              Spring 2026
     Note:
     Implements the LevelMeter UI component.
-    - Polls Measurement (atomic) peak values at refreshRate Hz via a Timer.
+    - Polls Measurement (atomic) peak values once per frame of the shared RefreshScheduler.
     - Applies fast attack / exponential release smoothing to linear levels.
     - Converts smoothed linear levels to dB and maps them to pixel positions.
-    - Draws left/right vertical meters, tick lines and dB labels.
+    - Draws left/right vertical meters; tick lines and dB labels are cached in an image.
+    - Repaints only the part of a bar that moved, and nothing if no bar moved a pixel.
     - Safe to use with the audio thread updating Measurement (readAndReset is atomic).
   ==============================================================================
 */
@@ -26,26 +27,47 @@ LevelMeter::LevelMeter(Measurement& measurementL_, Measurement& measurementR_)
       dbLevelL(clampdB), dbLevelR(clampdB) // initialize displayed dB to clamp floor
 {
     setOpaque(true);                      // component fully repaints its background
-    startTimerHz(refreshRate);            // start timer to poll measurements at refreshRate Hz
-    // decay factor for smoothing (derived from time constant 0.2s and timer rate)
-    decay = 1.0f - std::exp(-1.0f / (float(refreshRate) * 0.2f));
+    // decay factor for smoothing (derived from time constant 0.2s and the shared frame rate)
+    decay = 1.0f - std::exp(-1.0f / (float(RefreshScheduler::refreshRate) * 0.2f));
 }
 
 LevelMeter::~LevelMeter()
 {
-    // destructor: nothing special to do (timer stops automatically on destruction)
+    // destructor: nothing special to do (refreshAttachment unregisters itself)
 }
 
 // Paint the meter UI
+// Only the bars are drawn per frame; the static scale comes from a cached image.
 void LevelMeter::paint (juce::Graphics& g)
 {
-    const auto bounds = getLocalBounds();            // local drawing bounds
-
     g.fillAll(Colors::LevelMeter::background);       // fill background with meter background colour
 
     drawLevel(g, dbLevelL, 0, 7);                    // draw left channel meter at x=0, width=7
     drawLevel(g, dbLevelR, 9, 7);                    // draw right channel meter at x=9, width=7
 
+    // (re)build the tick/label overlay if it was invalidated or the display scale changed
+    float scaleFactor = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!scaleImage.isValid() || scaleFactor != scaleImageScale) {
+        renderScale(scaleFactor);
+    }
+    g.drawImage(scaleImage, getLocalBounds().toFloat()); // ticks are drawn on top of the bars
+}
+
+// Render the static part of the meter (tick lines and dB labels) into scaleImage.
+// The image is rendered at the physical pixel scale so text stays sharp on HiDPI screens.
+void LevelMeter::renderScale(float scaleFactor)
+{
+    const auto bounds = getLocalBounds();
+
+    scaleImageScale = scaleFactor;
+    scaleImage = juce::Image(juce::Image::ARGB,
+                             juce::jmax(1, juce::roundToInt(float(bounds.getWidth()) * scaleFactor)),
+                             juce::jmax(1, juce::roundToInt(float(bounds.getHeight()) * scaleFactor)),
+                             true); // start fully transparent
+
+    juce::Graphics g(scaleImage);
+    g.addTransform(juce::AffineTransform::scale(scaleFactor)); // draw in component coordinates
+
     g.setFont(Fonts::getFont(10.0f));                // use shared font for tick labels
     // draw tick lines and labels from maxdB down to mindB in steps of stepdB
     for (float db = maxdB; db >= mindB; db -= stepdB) {
@@ -65,15 +87,39 @@ void LevelMeter::resized()
 {
     maxPos = 4.0f;                       // top pixel for maxdB (4px from top)
     minPos = float(getHeight()) - 4.0f;  // bottom pixel for mindB (4px from bottom)
+
+    scaleImage = {};                     // tick positions moved: rebuild the overlay on next paint
+    barYL = barTopForLevel(dbLevelL);    // resync painted bar positions with the new scale
+    barYR = barTopForLevel(dbLevelR);
 }
 
-// Timer callback: poll measurements, update smoothing, and trigger repaint
-void LevelMeter::timerCallback()
+// Frame callback: poll measurements, update smoothing, and repaint only what moved
+void LevelMeter::refresh()
 {
     updateLevel(measurementL.readAndReset(), levelL, dbLevelL); // get L peak and update L state
     updateLevel(measurementR.readAndReset(), levelR, dbLevelR); // get R peak and update R state
 
-    repaint(); // schedule a paint to reflect new levels
+    // Changes smaller than one pixel are invisible, so they don't cause a repaint at all
+    int newYL = barTopForLevel(dbLevelL);
+    if (newYL != barYL) {
+        repaintBar(0, 7, barYL, newYL);
+        barYL = newYL;
+    }
+
+    int newYR = barTopForLevel(dbLevelR);
+    if (newYR != barYR) {
+        repaintBar(9, 7, barYR, newYR);
+        barYR = newYR;
+    }
+}
+
+// Mark the strip between the old and new top of a bar as dirty. Everything below
+// the lower of the two edges looks identical in both frames, so it is not repainted.
+void LevelMeter::repaintBar(int x, int width, int oldY, int newY)
+{
+    int top = std::min(oldY, newY);
+    int bottom = std::max(oldY, newY);
+    repaint(x, top, width, bottom - top);
 }
 
 // Draw a single channel's vertical level bar.
@@ -18,10 +18,11 @@
 
 #include <JuceHeader.h>                            // JUCE core GUI/audio includes
 #include "Measurement.h"                           // thread-safe peak measurement helper
+#include "RefreshScheduler.h"                      // shared per-frame UI clock
 
 // LevelMeter: a Component that polls Measurements and draws vertical bar meters.
-// Inherits juce::Timer privately to poll at a fixed refresh rate.
-class LevelMeter  : public juce::Component, private juce::Timer
+// Polled once per frame by the shared RefreshScheduler.
+class LevelMeter  : public juce::Component
 {
 public:
     // Constructor takes references to the left and right Measurement objects (no ownership)
@@ -32,7 +33,7 @@ public:
     void resized() override;     // handle layout changes
 
 private:
-    void timerCallback() override;                 // Timer callback to poll measurements periodically
+    void refresh();                                // per-frame callback to poll measurements
 
     // Convert dB level to a pixel position
     // Used to map dB -> vertical meter coordinate
@@ -41,7 +42,19 @@ private:
         return int(std::round(juce::jmap(dbLevel, maxdB, mindB, maxPos, minPos)));
     }
 
+    // Visible top edge of a bar (clamped to the component so off-scale changes are ignored)
+    int barTopForLevel(float dbLevel) const noexcept
+    {
+        return juce::jlimit(0, getHeight(), positionForLevel(dbLevel));
+    }
+
     void drawLevel(juce::Graphics& g, float level, int x, int width); // draw one channel's meter
+
+    // Render tick lines + dB labels into scaleImage (transparent overlay at physical pixel scale)
+    void renderScale(float scaleFactor);
+
+    // Repaint only the strip of a bar between its previous and new top edge
+    void repaintBar(int x, int width, int oldY, int newY);
     
     // Update smoothed linear level and compute dB value for rendering
     void updateLevel(float newLevel, float& smoothedLevel, float& leveldB) const;
@@ -63,11 +76,18 @@ private:
     float dbLevelL;                                // last computed dB for left channel
     float dbLevelR;                                // last computed dB for right channel
 
-    static constexpr int refreshRate = 60;         // UI refresh rate in Hz for the timer
+    int barYL = 0;                                 // last painted bar top (pixels) for left channel
+    int barYR = 0;                                 // last painted bar top (pixels) for right channel
+
+    juce::Image scaleImage;                        // cached static scale (ticks + labels)
+    float scaleImageScale = 0.0f;                  // physical pixel scale the cache was rendered at
 
     float decay = 0.0f;                    // per-frame decay used in smoothing logic
     float levelL = clampLevel;          // smoothed linear level left (starts near silence)
     float levelR = clampLevel;         // smoothed linear level right
 
+    // Per-frame polling driven by the shared scheduler (declared last: it calls refresh())
+    RefreshScheduler::Attachment refreshAttachment { *this, [this] { refresh(); } };
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LevelMeter) // disable copy, enable leak detection
 };
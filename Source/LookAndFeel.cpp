@@ -10,26 +10,33 @@
              
     Note:
     Implements the UI styling and rendering helpers:
-     - defines and loads the embedded typeface,
+     - loads the embedded typeface on first use,
      - provides color/font configuration,
      - implements custom LookAndFeel classes (RotaryKnob, Main, Button),
        including rotary knob drawing, slider textboxes, and button rendering.
+     - caches the static knob body per size / display scale so knob repaints
+       only draw the value arc and dial line.
      - uses a drop shadow and simple accessibility tweaks for slider editors.
   ==============================================================================
 */
 
 #include "LookAndFeel.h" // header with declarations for colours, fonts and L&F classes
 
-// Define the static Typeface pointer by creating a typeface from embedded binary data
+// Create the shared Typeface from embedded binary data the first time it is needed
+// (function-local static: initialisation is thread-safe, so a background preload is fine).
 // Note: (BinaryData::LatoMedium_ttf is the font file compiled into the binary).
 //       (font file is in Assets folder)
-const juce::Typeface::Ptr Fonts::typeface = juce::Typeface::createSystemTypefaceFor(
-    BinaryData::LatoMedium_ttf, BinaryData::LatoMedium_ttfSize);
+const juce::Typeface::Ptr& Fonts::getTypeface()
+{
+    static const juce::Typeface::Ptr typeface = juce::Typeface::createSystemTypefaceFor(
+        BinaryData::LatoMedium_ttf, BinaryData::LatoMedium_ttfSize);
+    return typeface;
+}
 
 // Return a juce::Font using the shared typeface with the requested height.
 juce::Font Fonts::getFont(float height)
 {
-    return juce::Font(typeface).withHeight(height);
+    return juce::Font(getTypeface()).withHeight(height);
 }
 
 // RotaryKnobLookAndFeel constructor: set up colours used by the knob drawing and text editing.
@@ -55,6 +62,9 @@ RotaryKnobLookAndFeel::RotaryKnobLookAndFeel()
 //  rotaryStartAngle - start angle in radians
 //  rotaryEndAngle   - end angle in radians
 //  slider           - reference to the slider being drawn
+//
+//  Everything that doesn't depend on the value comes from a cached image, so a
+//  repaint during automation only strokes the dial line and the value arc.
 void RotaryKnobLookAndFeel::drawRotarySlider(
      juce::Graphics& g,
      int x, int y, int width, [[maybe_unused]] int height,
@@ -66,47 +76,19 @@ void RotaryKnobLookAndFeel::drawRotarySlider(
     auto bounds = juce::Rectangle<int>(x, y, width, width).toFloat();
     auto knobRect = bounds.reduced(10.0f, 10.0f);
 
-    // Create an ellipse path for the knob and draw a drop shadow under it
-    auto path = juce::Path();
-    path.addEllipse(knobRect);
-    dropShadow.drawForPath(g, path);
-
-    // Draw the outer outline of the knob
-    g.setColour(Colors::Knob::outline);
-    g.fillEllipse(knobRect);
-
-    // Inner dial face with a vertical gradient for a subtle 3D look
-    auto innerRect = knobRect.reduced(2.0f, 2.0f);
-    auto gradient = juce::ColourGradient(
-        Colors::Knob::gradientTop, 0.0f, innerRect.getY(),
-        Colors::Knob::gradientBottom, 0.0f, innerRect.getBottom(), false);
-    g.setGradientFill(gradient);
-    g.fillEllipse(innerRect);
+    // Static knob body, rendered at the physical pixel scale of this context
+    float scaleFactor = g.getInternalContext().getPhysicalPixelScaleFactor();
+    g.drawImage(getKnobBody(width, scaleFactor, rotaryStartAngle, rotaryEndAngle), bounds);
 
     // Calculate geometry for the arc and dial indicator
+    auto innerRect = knobRect.reduced(2.0f, 2.0f);
     auto center = bounds.getCentre();
     auto radius = bounds.getWidth() / 2.0f;
-    auto lineWidth = 3.0f;
     auto arcRadius = radius - lineWidth/2.0f;
 
-    // Background arc path covering the full rotary range (inactive track)
-    juce::Path backgroundArc;
-    backgroundArc.addCentredArc(center.x,
-                                center.y,
-                                arcRadius,
-                                arcRadius,
-                                0.0f,
-                                rotaryStartAngle,
-                                rotaryEndAngle,
-                                true);
-
     // Stroke type for consistent rounded ends
     auto strokeType = juce::PathStrokeType(
         lineWidth, juce::PathStrokeType::curved, juce::PathStrokeType::rounded);
-    
-    // Draw the inactive track
-    g.setColour(Colors::Knob::trackBackground);
-    g.strokePath(backgroundArc, strokeType);
 
     // Calculate the dial (pointer) geometry and draw it
     auto dialRadius = innerRect.getHeight()/2.0f - lineWidth;
@@ -147,6 +129,88 @@ void RotaryKnobLookAndFeel::drawRotarySlider(
     }
 }
 
+// Look up (or render) the cached knob body for this size / scale factor / rotary range.
+// All knobs of the same size share one image, and each display scale gets its own entry
+// so the body stays sharp when a window moves to a HiDPI screen.
+const juce::Image& RotaryKnobLookAndFeel::getKnobBody(
+    int size, float scaleFactor, float rotaryStartAngle, float rotaryEndAngle)
+{
+    KnobBodyKey key { size, juce::roundToInt(scaleFactor * 100.0f), rotaryStartAngle, rotaryEndAngle };
+
+    auto it = knobBodies.find(key);
+    if (it != knobBodies.end()) {
+        it->second.lastUsed = ++knobBodyClock;
+        return it->second.image;
+    }
+
+    // drop the least recently used entry (e.g. a scale only passed through while resizing)
+    if (knobBodies.size() >= maxKnobBodies) {
+        auto oldest = std::min_element(knobBodies.begin(), knobBodies.end(),
+                                       [](const auto& a, const auto& b)
+                                       { return a.second.lastUsed < b.second.lastUsed; });
+        knobBodies.erase(oldest);
+    }
+
+    int pixels = juce::jmax(1, juce::roundToInt(float(size) * scaleFactor));
+    juce::Image image(juce::Image::ARGB, pixels, pixels, true); // transparent around the knob
+
+    juce::Graphics g(image);
+    g.addTransform(juce::AffineTransform::scale(float(pixels) / float(size)));
+    drawKnobBody(g, juce::Rectangle<int>(0, 0, size, size).toFloat(), rotaryStartAngle, rotaryEndAngle);
+
+    auto& entry = knobBodies[key];
+    entry.image = image;
+    entry.lastUsed = ++knobBodyClock;
+    return entry.image;
+}
+
+// Draw the value-independent part of a knob: drop shadow, outline, gradient face
+// and the inactive background arc. The 10 px margin around the face leaves room
+// for the shadow, so nothing is drawn outside bounds.
+void RotaryKnobLookAndFeel::drawKnobBody(
+    juce::Graphics& g, juce::Rectangle<float> bounds,
+    float rotaryStartAngle, float rotaryEndAngle)
+{
+    auto knobRect = bounds.reduced(10.0f, 10.0f);
+
+    // Create an ellipse path for the knob and draw a drop shadow under it
+    auto path = juce::Path();
+    path.addEllipse(knobRect);
+    dropShadow.drawForPath(g, path);
+
+    // Draw the outer outline of the knob
+    g.setColour(Colors::Knob::outline);
+    g.fillEllipse(knobRect);
+
+    // Inner dial face with a vertical gradient for a subtle 3D look
+    auto innerRect = knobRect.reduced(2.0f, 2.0f);
+    auto gradient = juce::ColourGradient(
+        Colors::Knob::gradientTop, 0.0f, innerRect.getY(),
+        Colors::Knob::gradientBottom, 0.0f, innerRect.getBottom(), false);
+    g.setGradientFill(gradient);
+    g.fillEllipse(innerRect);
+
+    // Background arc path covering the full rotary range (inactive track)
+    auto center = bounds.getCentre();
+    auto radius = bounds.getWidth() / 2.0f;
+    auto arcRadius = radius - lineWidth/2.0f;
+
+    juce::Path backgroundArc;
+    backgroundArc.addCentredArc(center.x,
+                                center.y,
+                                arcRadius,
+                                arcRadius,
+                                0.0f,
+                                rotaryStartAngle,
+                                rotaryEndAngle,
+                                true);
+
+    // Draw the inactive track
+    g.setColour(Colors::Knob::trackBackground);
+    g.strokePath(backgroundArc, juce::PathStrokeType(
+        lineWidth, juce::PathStrokeType::curved, juce::PathStrokeType::rounded));
+}
+
 // Return font used for labels; currently uses the shared Fonts helper.
 juce::Font RotaryKnobLookAndFeel::getLabelFont([[maybe_unused]] juce::Label& label)
 {
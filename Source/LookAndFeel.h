@@ -58,6 +58,21 @@ namespace Colors
         const juce::Colour tooLoud { 226, 74, 81 };      // red colour for clipping/too loud indicator
         const juce::Colour levelOK { 65, 206, 88 };      // green for normal levels
     }
+
+    namespace EchoVisualizer
+    {
+        const juce::Colour background { 235, 227, 240 }; // same panel colour as the level meter
+        const juce::Colour waveform { 158, 12, 232 };    // wet-signal envelope fill
+        const juce::Colour marker { 15, 136, 191 };      // feedback repeat markers / zero line
+    }
+
+    namespace Spectrum
+    {
+        const juce::Colour background { 235, 227, 240 };              // same panel colour as the level meter
+        const juce::Colour input { 15, 136, 191 };                    // dry input spectrum line
+        const juce::Colour feedback { 158, 12, 232, 0.45f };          // feedback path spectrum fill
+        const juce::Colour response { 240, 100, 219 };                // Low Cut / High Cut response curve
+    }
 }
 
 // Small Fonts helper: provides a shared font for labels (singleton style).
@@ -68,8 +83,9 @@ public:
 
     static juce::Font getFont(float height = 20.0f); // returns a font of requested height
 
-private:
-    static const juce::Typeface::Ptr typeface; // underlying typeface pointer (defined in .cpp)
+    // Shared typeface, created from the embedded font on first use (not at library load,
+    // so plug-in scanning and editor-less instances never pay for it). Thread-safe.
+    static const juce::Typeface::Ptr& getTypeface();
 };
 
 // Custom LookAndFeel for rotary knobs.
@@ -105,8 +121,34 @@ private:
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RotaryKnobLookAndFeel)
     // disables copying/moving and adds leak detector helpful during debugging
 
+    // Return the static part of a knob (shadow, outline, gradient face, background arc)
+    // pre-rendered for this size and display scale; renders it on first use.
+    const juce::Image& getKnobBody(int size, float scaleFactor,
+                                   float rotaryStartAngle, float rotaryEndAngle);
+
+    // Draw the static part of a knob into g (used to fill the cache)
+    void drawKnobBody(juce::Graphics& g, juce::Rectangle<float> bounds,
+                      float rotaryStartAngle, float rotaryEndAngle);
+
+    // Cache key: size in logical pixels, scale factor in 1/100 steps, rotary range
+    using KnobBodyKey = std::tuple<int, int, float, float>;
+
+    struct KnobBody
+    {
+        juce::Image image;
+        juce::uint32 lastUsed = 0;  // value of knobBodyClock when last drawn
+    };
+
+    // one image per knob size / scale (message thread only); resizing the editor
+    // creates new entries, so only the most recently used ones are kept
+    std::map<KnobBodyKey, KnobBody> knobBodies;
+    juce::uint32 knobBodyClock = 0;
+    static constexpr size_t maxKnobBodies = 8;
+
     // Drop shadow used when drawing knobs; constructed with color, radius and offset
     juce::DropShadow dropShadow { Colors::Knob::dropShadow, 6, { 0, 3 } };
+
+    static constexpr float lineWidth = 3.0f; // stroke width of arcs and dial line
 };
 
 // Primary LookAndFeel for the main UI (labels, general widgets).
@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+    OutputKernels.h
+    Created: 4 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:   header-only output stage kernels: out = (dry + wet * mix) * gain,
+            one channel per call.
+
+            Aliasing contract (this is what __restrict promises the compiler):
+             - mixInPlace: io holds the dry input and receives the output, so it
+               is read and written at the same index only. wet, mix and gain must
+               not overlap io.
+             - mixOutOfPlace: output must not overlap input, wet, mix or gain.
+               input may be shared with other calls (a mono input feeding both
+               output channels).
+            With those guarantees every iteration is independent and the loops
+            vectorize; without them the compiler has to assume each store to the
+            output can change the next wet / mix / gain load.
+
+            The host hands us the same memory for input and output (in-place
+            buses), so callers must order the channels so that no kernel
+            overwrites an input another channel still has to read, or stage that
+            input in a scratch buffer first.
+  ==============================================================================
+*/
+
+#pragma once
+
+// In-place: io[i] = (io[i] + wet[i] * mix[i]) * gain[i]
+inline void mixInPlace(float* __restrict io,
+                       const float* __restrict wet,
+                       const float* __restrict mix,
+                       const float* __restrict gain,
+                       int numSamples) noexcept
+{
+    for (int i = 0; i < numSamples; ++i) {
+        io[i] = (io[i] + wet[i] * mix[i]) * gain[i];
+    }
+}
+
+// Out-of-place: output[i] = (input[i] + wet[i] * mix[i]) * gain[i]
+inline void mixOutOfPlace(float* __restrict output,
+                          const float* __restrict input,
+                          const float* __restrict wet,
+                          const float* __restrict mix,
+                          const float* __restrict gain,
+                          int numSamples) noexcept
+{
+    for (int i = 0; i < numSamples; ++i) {
+        output[i] = (input[i] + wet[i] * mix[i]) * gain[i];
+    }
+}
+
+// Picks the kernel for one channel from its bus pointers. input and output are
+// either the same channel (in-place) or separate channels (never partly overlapping).
+inline void mixChannel(float* output, const float* input,
+                       const float* wet, const float* mix, const float* gain,
+                       int numSamples) noexcept
+{
+    if (output == input) {
+        mixInPlace(output, wet, mix, gain, numSamples);
+    } else {
+        mixOutOfPlace(output, input, wet, mix, gain, numSamples);
+    }
+}
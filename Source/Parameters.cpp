@@ -12,15 +12,17 @@
     - looks up APVTS parameters
     - provides string formatting/parsing for the UI
     - maintains runtime copies of parameter values and smoothers
+    - captures / applies / publishes parameter snapshots (presets)
+    - blends the continuous parameters between the A/B morph slots
   ==============================================================================
 */
 
 #include "Parameters.h"
 
-//"DSP.h"
+//"Core/DSP.h"
 //header-only helper that computes equal‑power
 //panning gains for left and right channels.
-#include "DSP.h"
+#include "Core/DSP.h"
 
 
 // Helper template to safely cast an APVTS parameter to the expected type.
@@ -106,6 +108,30 @@ Parameters::Parameters(juce::AudioProcessorValueTreeState& apvts)
     castParameter(apvts, highCutParamID, highCutParam);
     castParameter(apvts, tempoSyncParamID, tempoSyncParam);
     castParameter(apvts, delayNoteParamID, delayNoteParam);
+    castParameter(apvts, morphParamID, morphParam);
+    castParameter(apvts, morphOnParamID, morphOnParam);
+    castParameter(apvts, resonatorParamID, resonatorParam);
+    castParameter(apvts, colorParamID, colorParam);
+    castParameter(apvts, colorPlacementParamID, colorPlacementParam);
+
+    snapshotParams = { gainParam, delayTimeParam, mixParam, feedbackParam, stereoParam,
+                       lowCutParam, highCutParam, tempoSyncParam, delayNoteParam };
+}
+
+// Default value of every snapshot parameter (the layout below uses these too).
+Parameters::Snapshot Parameters::getDefaults() noexcept
+{
+    Snapshot defaults;
+    defaults.values[gainIndex] = 0.0f;          // dB
+    defaults.values[delayTimeIndex] = 100.0f;   // ms
+    defaults.values[mixIndex] = 100.0f;         // %
+    defaults.values[feedbackIndex] = 0.0f;      // %
+    defaults.values[stereoIndex] = 0.0f;        // %
+    defaults.values[lowCutIndex] = 20.0f;       // Hz
+    defaults.values[highCutIndex] = 20000.0f;   // Hz
+    defaults.values[tempoSyncIndex] = 0.0f;     // off
+    defaults.values[delayNoteIndex] = 9.0f;     // 1/4
+    return defaults;
 }
 
 // Build the APVTS parameter layout: defines parameters (IDs, names, ranges, defaults)
@@ -113,13 +139,14 @@ Parameters::Parameters(juce::AudioProcessorValueTreeState& apvts)
 juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterLayout()
 {
     juce::AudioProcessorValueTreeState::ParameterLayout layout;
+    const auto defaults = getDefaults().values;
 
     // Output gain in dB (-12..+12), displayed using dB formatter.
     layout.add(std::make_unique<juce::AudioParameterFloat>(
         gainParamID,
         "Output Gain",
         juce::NormalisableRange<float> { -12.0f, 12.0f },
-        0.0f,
+        defaults[gainIndex],
         juce::AudioParameterFloatAttributes().withStringFromValueFunction(stringFromDecibels)
     ));
 
@@ -128,7 +155,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
         delayTimeParamID,
         "Delay Time",
         juce::NormalisableRange<float> { minDelayTime, maxDelayTime, 0.001f, 0.25f },
-        100.0f,
+        defaults[delayTimeIndex],
         juce::AudioParameterFloatAttributes()
             .withStringFromValueFunction(stringFromMilliseconds)
             .withValueFromStringFunction(millisecondsFromString)
@@ -139,7 +166,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
         mixParamID,
         "Mix",
         juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
-        100.0f,
+        defaults[mixIndex],
         juce::AudioParameterFloatAttributes().withStringFromValueFunction(stringFromPercent)
     ));
 
@@ -147,7 +174,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
         feedbackParamID,
         "Feedback",
         juce::NormalisableRange<float>(-100.0f, 100.0f, 1.0f),
-        0.0f,
+        defaults[feedbackIndex],
         juce::AudioParameterFloatAttributes().withStringFromValueFunction(stringFromPercent)
     ));
 
@@ -156,7 +183,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
         stereoParamID,
         "Stereo",
         juce::NormalisableRange<float>(-100.0f, 100.0f, 1.0f),
-        0.0f,
+        defaults[stereoIndex],
         juce::AudioParameterFloatAttributes().withStringFromValueFunction(stringFromPercent)
     ));
 
@@ -165,7 +192,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
         lowCutParamID,
         "Low Cut",
         juce::NormalisableRange<float>(20.0f, 20000.0f, 1.0f, 0.3f),
-        20.0f,
+        defaults[lowCutIndex],
         juce::AudioParameterFloatAttributes()
             .withStringFromValueFunction(stringFromHz)
             .withValueFromStringFunction(hzFromString)
@@ -175,7 +202,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
         highCutParamID,
         "High Cut",
         juce::NormalisableRange<float>(20.0f, 20000.0f, 1.0f, 0.3f),
-        20000.0f,
+        defaults[highCutIndex],
         juce::AudioParameterFloatAttributes()
             .withStringFromValueFunction(stringFromHz)
             .withValueFromStringFunction(hzFromString)
@@ -183,7 +210,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
 
     // Simple boolean toggle for tempo sync
     layout.add(std::make_unique<juce::AudioParameterBool>(
-        tempoSyncParamID, "Tempo Sync", false));
+        tempoSyncParamID, "Tempo Sync", defaults[tempoSyncIndex] > 0.5f));
 
     // Choice list for note subdivisions used when tempoSync is active.
     juce::StringArray noteLengths = {
@@ -206,7 +233,31 @@ juce::AudioProcessorValueTreeState::ParameterLayout Parameters::createParameterL
     };
 
     layout.add(std::make_unique<juce::AudioParameterChoice>(
-        delayNoteParamID, "Delay Note", noteLengths, 9)); // default index = 9 (1/4)
+        delayNoteParamID, "Delay Note", noteLengths, int(defaults[delayNoteIndex]))); // default index = 9 (1/4)
+
+    // A/B morph amount (0 = slot A, 100 = slot B) and the switch that engages it
+    layout.add(std::make_unique<juce::AudioParameterFloat>(
+        morphParamID,
+        "Morph",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 0.1f),
+        0.0f,
+        juce::AudioParameterFloatAttributes().withStringFromValueFunction(stringFromPercent)
+    ));
+
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        morphOnParamID, "Morph On", false));
+
+    // MIDI resonator mode: notes tune Karplus-Strong voices that ring with the input
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        resonatorParamID, "Resonator", false));
+
+    // Echo color: impulse response convolved in the feedback loop (see ImpulseLibrary)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        colorParamID, "Color", juce::StringArray { "Clean", "Tape", "Spring" }, 0));
+
+    // ... or only on the wet output: every repeat gets the same amount of color
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        colorPlacementParamID, "Color Placement", juce::StringArray { "Loop", "Wet" }, 0));
 
     return layout;
 }
@@ -236,6 +287,8 @@ void Parameters::reset() noexcept
     gainSmoother.setCurrentAndTargetValue(juce::Decibels::decibelsToGain(gainParam->get()));
 
     delayTime = 0.0f; // targetDelayTime will be initialized on the first update
+    readAhead = 0.0f; // the processor starts with the Color stage off
+    targetReadAhead = 0.0f;
 
     mix = 1.0f;
     mixSmoother.setCurrentAndTargetValue(mixParam->get() * 0.01f); // UI is 0..100 -> 0..1
@@ -256,26 +309,81 @@ void Parameters::reset() noexcept
 
 // update: called (typically at block start) to read raw APVTS values and set targets
 // for the smoothers. Does not advance smoothers — smoothen() does that per-sample.
+// If a snapshot was published since the last block, its values are used instead,
+// so all parameters of a preset switch arrive in the same block.
 void Parameters::update() noexcept
 {
-    gainSmoother.setTargetValue(juce::Decibels::decibelsToGain(gainParam->get()));
+    Snapshot target;
+    bool hasSnapshot = false;
+    while (snapshotFifo.getNumReady() > 0) {          // keep only the newest one
+        const auto scope = snapshotFifo.read(1);
+        target = snapshotSlots[size_t(scope.startIndex1)];
+        hasSnapshot = true;
+    }
+
+    if (!hasSnapshot) {
+        target.values[gainIndex] = gainParam->get();
+        target.values[delayTimeIndex] = delayTimeParam->get();
+        target.values[mixIndex] = mixParam->get();
+        target.values[feedbackIndex] = feedbackParam->get();
+        target.values[stereoIndex] = stereoParam->get();
+        target.values[lowCutIndex] = lowCutParam->get();
+        target.values[highCutIndex] = highCutParam->get();
+        target.values[tempoSyncIndex] = tempoSyncParam->get() ? 1.0f : 0.0f;
+        target.values[delayNoteIndex] = float(delayNoteParam->getIndex());
+    }
+
+    // morph is computed once per block (control rate); the smoothers below
+    // turn the per-block steps into ramps
+    if (morphOnParam->get()) {
+        applyMorph(target, morphParam->get() * 0.01f);
+    }
+
+    gainSmoother.setTargetValue(juce::Decibels::decibelsToGain(target.values[gainIndex]));
 
     // raw target delay time read from parameter; if delayTime is uninitialized (0)
     // we set it immediately to avoid a jump on first frame.
-    targetDelayTime = delayTimeParam->get();
+    targetDelayTime = target.values[delayTimeIndex];
     if (delayTime == 0.0f) {
         delayTime = targetDelayTime;
     }
 
-    mixSmoother.setTargetValue(mixParam->get() * 0.01f);
-    feedbackSmoother.setTargetValue(feedbackParam->get() * 0.01f);
-    stereoSmoother.setTargetValue(stereoParam->get() * 0.01f);
-    lowCutSmoother.setTargetValue(lowCutParam->get());
-    highCutSmoother.setTargetValue(highCutParam->get());
+    mixSmoother.setTargetValue(target.values[mixIndex] * 0.01f);
+    feedbackSmoother.setTargetValue(target.values[feedbackIndex] * 0.01f);
+    stereoSmoother.setTargetValue(target.values[stereoIndex] * 0.01f);
+    lowCutSmoother.setTargetValue(target.values[lowCutIndex]);
+    highCutSmoother.setTargetValue(target.values[highCutIndex]);
+    effectiveLowCut.store(target.values[lowCutIndex], std::memory_order_relaxed);
+    effectiveHighCut.store(target.values[highCutIndex], std::memory_order_relaxed);
 
     // copy choice index and tempo sync flag for quick access on the audio thread
-    delayNote = delayNoteParam->getIndex();
-    tempoSync = tempoSyncParam->get();
+    delayNote = int(target.values[delayNoteIndex]);
+    tempoSync = target.values[tempoSyncIndex] >= 0.5f;
+
+    resonator = resonatorParam->get();
+    color = colorParam->getIndex();
+    colorInLoop = colorPlacementParam->getIndex() == 0;
+}
+
+// applyMorph: blend the continuous parameters (gainIndex .. highCutIndex) between the
+// two slots. Cutoffs are blended on a log scale so the sweep sounds even; the rest
+// linearly in their plain units. Tempo sync and note length are not morphed.
+void Parameters::applyMorph(Snapshot& target, float amount) const noexcept
+{
+    const auto& slotA = morphSlots[morphA];
+    const auto& slotB = morphSlots[morphB];
+    bool hasA = slotA.stored.load();
+    bool hasB = slotB.stored.load();
+
+    for (size_t i = 0; i <= size_t(highCutIndex); ++i) {
+        float a = hasA ? slotA.values[i].load(std::memory_order_relaxed) : target.values[i];
+        float b = hasB ? slotB.values[i].load(std::memory_order_relaxed) : target.values[i];
+        if (i == size_t(lowCutIndex) || i == size_t(highCutIndex)) {
+            target.values[i] = a * std::pow(b / a, amount); // cutoffs are >= 20 Hz
+        } else {
+            target.values[i] = a + (b - a) * amount;
+        }
+    }
 }
 
 // smoothen: step the smoothers / apply one-pole smoothing for delayTime.
@@ -286,6 +394,7 @@ void Parameters::smoothen() noexcept
 
     // simple one-pole toward the target delay time (ms)
     delayTime += (targetDelayTime - delayTime) * coeff;
+    readAhead += (targetReadAhead - readAhead) * coeff; // same glide for the Color read-ahead
 
     mix = mixSmoother.getNextValue();
     feedback = feedbackSmoother.getNextValue();
@@ -296,3 +405,66 @@ void Parameters::smoothen() noexcept
     lowCut = lowCutSmoother.getNextValue();
     highCut = highCutSmoother.getNextValue();
 }
+
+// capture: read every parameter in plain units (message thread).
+Parameters::Snapshot Parameters::capture() const
+{
+    Snapshot snapshot;
+    for (size_t i = 0; i < snapshotParams.size(); ++i) {
+        auto* param = snapshotParams[i];
+        snapshot.values[i] = param->convertFrom0to1(param->getValue());
+    }
+    return snapshot;
+}
+
+// applyToHost: set every parameter from a snapshot (message thread). Goes through
+// setValueNotifyingHost so the host, the attachments and the editor all follow.
+void Parameters::applyToHost(const Snapshot& snapshot)
+{
+    for (size_t i = 0; i < snapshotParams.size(); ++i) {
+        auto* param = snapshotParams[i];
+        param->setValueNotifyingHost(param->convertTo0to1(snapshot.values[i]));
+    }
+}
+
+// publish: lock-free handoff to the audio thread (single producer). If the audio
+// thread hasn't picked up the previous snapshots yet the new one is dropped; the
+// applyToHost call that follows still delivers it through the parameters.
+void Parameters::publish(const Snapshot& snapshot) noexcept
+{
+    const auto scope = snapshotFifo.write(1);
+    if (scope.blockSize1 > 0) {
+        snapshotSlots[size_t(scope.startIndex1)] = snapshot;
+    }
+}
+
+// Morph slots (message thread). stored is set last so update() never blends
+// with a slot that hasn't been filled yet.
+void Parameters::setMorphSlot(int slot, const Snapshot& snapshot) noexcept
+{
+    auto& morphSlot = morphSlots[size_t(slot)];
+    for (size_t i = 0; i < snapshot.values.size(); ++i) {
+        morphSlot.values[i].store(snapshot.values[i], std::memory_order_relaxed);
+    }
+    morphSlot.stored.store(true);
+}
+
+void Parameters::clearMorphSlot(int slot) noexcept
+{
+    morphSlots[size_t(slot)].stored.store(false);
+}
+
+bool Parameters::hasMorphSlot(int slot) const noexcept
+{
+    return morphSlots[size_t(slot)].stored.load();
+}
+
+Parameters::Snapshot Parameters::getMorphSlot(int slot) const noexcept
+{
+    Snapshot snapshot;
+    const auto& morphSlot = morphSlots[size_t(slot)];
+    for (size_t i = 0; i < snapshot.values.size(); ++i) {
+        snapshot.values[i] = morphSlot.values[i].load(std::memory_order_relaxed);
+    }
+    return snapshot;
+}
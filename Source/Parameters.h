@@ -16,6 +16,7 @@
 #pragma once
 
 #include <JuceHeader.h> // main JUCE include (Audio, GUI, DSP, etc.)
+#include "Core/Smoothers.h" // LinearSmoother (JUCE-free)
 
 // ParameterID constants used to identify parameters in the APVTS (stable IDs)
 const juce::ParameterID gainParamID { "gain", 1 };
@@ -27,6 +28,11 @@ const juce::ParameterID lowCutParamID { "lowCut", 1 };
 const juce::ParameterID highCutParamID { "highCut", 1 };
 const juce::ParameterID tempoSyncParamID { "tempoSync", 1 };
 const juce::ParameterID delayNoteParamID { "delayNote", 1 };
+const juce::ParameterID morphParamID { "morph", 1 };
+const juce::ParameterID morphOnParamID { "morphOn", 1 };
+const juce::ParameterID resonatorParamID { "resonator", 1 };
+const juce::ParameterID colorParamID { "color", 1 };
+const juce::ParameterID colorPlacementParamID { "colorPlacement", 1 };
 
 // Parameters helper: holds runtime parameter values, smoothing, and ties to APVTS.
 class Parameters
@@ -44,6 +50,43 @@ public:
     void update() noexcept;                         // pull values from APVTS parameters
     void smoothen() noexcept;                       // step smoothers (call per-sample or per-block)
 
+    // Snapshot of every automatable parameter in plain (unnormalised) units, e.g. for presets.
+    // The index order is part of the preset file format: only ever append to it.
+    enum SnapshotIndex
+    {
+        gainIndex, delayTimeIndex, mixIndex, feedbackIndex, stereoIndex,
+        lowCutIndex, highCutIndex, tempoSyncIndex, delayNoteIndex,
+        numSnapshotValues
+    };
+
+    struct Snapshot
+    {
+        std::array<float, numSnapshotValues> values {};
+    };
+
+    // The layout's default values as a snapshot (e.g. to fill in values that were
+    // appended after a preset was saved).
+    static Snapshot getDefaults() noexcept;
+
+    Snapshot capture() const;                       // message thread: current APVTS values
+    void applyToHost(const Snapshot& snapshot);     // message thread: set APVTS params (host + UI follow)
+
+    // Hand a snapshot to the audio thread without locking. The next update() uses it as
+    // the target for all smoothers at once, so a preset switch never shows up half-applied;
+    // call applyToHost right after so later blocks read the same values from the APVTS.
+    void publish(const Snapshot& snapshot) noexcept;
+
+    // A/B morph slots. While Morph is on, update() blends the continuous parameters
+    // (gain, delay time, mix, feedback, stereo, low / high cut) from slot A to slot B
+    // by the Morph amount and feeds the result to the smoothers, so one automation
+    // lane replaces seven. An empty slot stands in for the current parameter values.
+    enum MorphSlot { morphA, morphB, numMorphSlots };
+
+    void setMorphSlot(int slot, const Snapshot& snapshot) noexcept; // message thread
+    void clearMorphSlot(int slot) noexcept;
+    bool hasMorphSlot(int slot) const noexcept;
+    Snapshot getMorphSlot(int slot) const noexcept;
+
     // Public runtime parameter values (exposed so audio thread can read them cheaply)
     float gain = 0.0f;         // linear gain (derived from dB parameter)
     float delayTime = 0.0f;    // smoothed delay time (ms)
@@ -55,6 +98,20 @@ public:
     float highCut = 20000.0f;  // high cut cutoff (Hz)
     int delayNote = 0;         // index into note-length choices (0..15)
     bool tempoSync = false;    // whether delay is tempo-synced
+    bool resonator = false;    // MIDI resonator mode (not part of snapshots / presets)
+    int color = 0;             // echo color: 0 = clean, then ImpulseLibrary::Character + 1
+    bool colorInLoop = true;   // Color in the feedback loop (true) or on the wet output only
+
+    // Samples the delay lines are read early to make up for the Color stage's latency.
+    // The processor sets the target each block; smoothen() ramps readAhead toward it
+    // like delayTime, so switching Color on or off glides the read position.
+    void setReadAhead(float samples) noexcept { targetReadAhead = samples; }
+    float readAhead = 0.0f;    // smoothed read-ahead (samples)
+
+    // Cutoff targets (Hz) in effect after morphing, published by update() (each block) for
+    // the UI's filter response curve (the APVTS values differ while Morph is on)
+    std::atomic<float> effectiveLowCut { 20.0f };
+    std::atomic<float> effectiveHighCut { 20000.0f };
 
     // Allowed delay range (ms)
     static constexpr float minDelayTime = 5.0f;
@@ -66,27 +123,54 @@ public:
 private:
     // Internal pointers to APVTS parameters (set by the constructor via dynamic cast)
     juce::AudioParameterFloat* gainParam;
-    juce::LinearSmoothedValue<float> gainSmoother; // smooths gain changes
+    LinearSmoother gainSmoother; // smooths gain changes
 
     juce::AudioParameterFloat* delayTimeParam;     // raw delay-time parameter (ms)
 
     float targetDelayTime = 0.0f; // the target (unsmoothed) delay time to approach
     float coeff = 0.0f;           // one-pole smoothing coefficient (computed from sampleRate)
+    float targetReadAhead = 0.0f; // Color latency to approach (samples)
 
     juce::AudioParameterFloat* mixParam;
-    juce::LinearSmoothedValue<float> mixSmoother;
+    LinearSmoother mixSmoother;
 
     juce::AudioParameterFloat* feedbackParam;
-    juce::LinearSmoothedValue<float> feedbackSmoother;
+    LinearSmoother feedbackSmoother;
 
     juce::AudioParameterFloat* stereoParam;
-    juce::LinearSmoothedValue<float> stereoSmoother;
+    LinearSmoother stereoSmoother;
 
     juce::AudioParameterFloat* lowCutParam;
-    juce::LinearSmoothedValue<float> lowCutSmoother;
+    LinearSmoother lowCutSmoother;
 
     juce::AudioParameterFloat* highCutParam;
-    juce::LinearSmoothedValue<float> highCutSmoother;
+    LinearSmoother highCutSmoother;
 
     juce::AudioParameterChoice* delayNoteParam; // choice list for note subdivisions (UI)
+
+    juce::AudioParameterFloat* morphParam;      // A -> B morph amount (0..100 %)
+    juce::AudioParameterBool* morphOnParam;     // morph engaged
+
+    juce::AudioParameterBool* resonatorParam;   // MIDI resonator mode on / off
+    juce::AudioParameterChoice* colorParam;     // Clean / Tape / Spring
+    juce::AudioParameterChoice* colorPlacementParam; // Loop / Wet
+
+    // Morph slot values, written by the message thread and read by update(). Values are
+    // individually atomic; a store racing a block only shows up for that one block and
+    // goes through the smoothers like any other parameter change.
+    struct MorphSlotValues
+    {
+        std::array<std::atomic<float>, numSnapshotValues> values {};
+        std::atomic<bool> stored { false };
+    };
+    std::array<MorphSlotValues, numMorphSlots> morphSlots;
+
+    void applyMorph(Snapshot& target, float amount) const noexcept;
+
+    // All parameters in SnapshotIndex order (for capture / applyToHost)
+    std::array<juce::RangedAudioParameter*, numSnapshotValues> snapshotParams {};
+
+    // Lock-free single-producer / single-consumer handoff of published snapshots
+    juce::AbstractFifo snapshotFifo { 4 };
+    std::array<Snapshot, 4> snapshotSlots;
 };
@@ -0,0 +1,156 @@
+/*
+  ==============================================================================
+    PartitionedConvolver.cpp
+    Created: 6 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the overlap-save convolver. The complex multiply-accumulate
+    over all partitions is where the time goes; it runs on split re / im
+    arrays with restrict-qualified pointers so it compiles to SIMD code.
+  ==============================================================================
+*/
+
+#include "PartitionedConvolver.h"
+
+// acc += x * h for numBins complex values (split-complex layout)
+static void complexMultiplyAccumulate(const float* __restrict xRe, const float* __restrict xIm,
+                                      const float* __restrict hRe, const float* __restrict hIm,
+                                      float* __restrict accRe, float* __restrict accIm,
+                                      int numBins) noexcept
+{
+    for (int k = 0; k < numBins; ++k) {
+        accRe[k] += xRe[k] * hRe[k] - xIm[k] * hIm[k];
+        accIm[k] += xRe[k] * hIm[k] + xIm[k] * hRe[k];
+    }
+}
+
+void PartitionedConvolver::prepare(double sampleRate)
+{
+    int longest = 0;
+    for (int c = 0; c < ImpulseLibrary::numCharacters; ++c) {
+        spectra[size_t(c)] = library->get(c, sampleRate);
+        longest = juce::jmax(longest, spectra[size_t(c)]->numPartitions);
+    }
+
+    fdlSlots = longest;
+    fdlRe.assign(size_t(fdlSlots * numBins), 0.0f);
+    fdlIm.assign(size_t(fdlSlots * numBins), 0.0f);
+
+    setCharacter(character); // keep the selection across re-prepares
+    reset();
+}
+
+void PartitionedConvolver::release()
+{
+    active = nullptr;
+    for (auto& entry : spectra) {
+        entry.reset();
+    }
+    fdlRe = {};
+    fdlIm = {};
+    fdlSlots = 0;
+}
+
+void PartitionedConvolver::reset() noexcept
+{
+    std::fill(fdlRe.begin(), fdlRe.end(), 0.0f);
+    std::fill(fdlIm.begin(), fdlIm.end(), 0.0f);
+    fdlIndex = 0;
+
+    previousBlock.fill(0.0f);
+    inputBlock.fill(0.0f);
+    outputBlock.fill(0.0f);
+    position = 0;
+}
+
+void PartitionedConvolver::setCharacter(int newCharacter) noexcept
+{
+    jassert(newCharacter >= 0 && newCharacter < ImpulseLibrary::numCharacters);
+    character = newCharacter;
+    active = spectra[size_t(character)].get(); // nullptr until prepared
+}
+
+float PartitionedConvolver::processSample(float input) noexcept
+{
+    inputBlock[size_t(position)] = input;
+    float output = outputBlock[size_t(position)];
+
+    if (++position == blockSize) {
+        processPartition();
+        position = 0;
+    }
+    return output;
+}
+
+// Same as processSample for every sample, copied in runs up to the next block boundary.
+void PartitionedConvolver::process(float* io, int numSamples) noexcept
+{
+    int i = 0;
+    while (i < numSamples) {
+        int run = juce::jmin(numSamples - i, blockSize - position);
+        std::copy(io + i, io + i + run, inputBlock.begin() + position);
+        std::copy(outputBlock.begin() + position, outputBlock.begin() + position + run, io + i);
+
+        i += run;
+        position += run;
+        if (position == blockSize) {
+            processPartition();
+            position = 0;
+        }
+    }
+}
+
+void PartitionedConvolver::processPartition() noexcept
+{
+    if (active == nullptr) {
+        outputBlock.fill(0.0f); // not prepared
+        return;
+    }
+
+    // Overlap-save input: the previous and the new block
+    std::copy(previousBlock.begin(), previousBlock.end(), fftData.begin());
+    std::copy(inputBlock.begin(), inputBlock.end(), fftData.begin() + blockSize);
+    std::fill(fftData.begin() + fftSize, fftData.end(), 0.0f);
+    previousBlock = inputBlock;
+
+    fft.performRealOnlyForwardTransform(fftData.data(), true);
+
+    // Newest spectrum into the FDL
+    float* newRe = fdlRe.data() + fdlIndex * numBins;
+    float* newIm = fdlIm.data() + fdlIndex * numBins;
+    for (int k = 0; k < numBins; ++k) {
+        newRe[k] = fftData[size_t(2 * k)];
+        newIm[k] = fftData[size_t(2 * k + 1)];
+    }
+
+    // Y = sum over partitions p of X(k - p) * H(p)
+    accRe.fill(0.0f);
+    accIm.fill(0.0f);
+    int slot = fdlIndex;
+    for (int p = 0; p < active->numPartitions; ++p) {
+        complexMultiplyAccumulate(fdlRe.data() + slot * numBins, fdlIm.data() + slot * numBins,
+                                  active->re.data() + p * numBins, active->im.data() + p * numBins,
+                                  accRe.data(), accIm.data(), numBins);
+        slot = slot == 0 ? fdlSlots - 1 : slot - 1;
+    }
+    fdlIndex = fdlIndex + 1 == fdlSlots ? 0 : fdlIndex + 1;
+
+    // Back to the time domain; the inverse wants the full (conjugate-symmetric) spectrum
+    for (int k = 0; k < numBins; ++k) {
+        fftData[size_t(2 * k)] = accRe[size_t(k)];
+        fftData[size_t(2 * k + 1)] = accIm[size_t(k)];
+    }
+    for (int k = numBins; k < fftSize; ++k) {
+        fftData[size_t(2 * k)] = accRe[size_t(fftSize - k)];
+        fftData[size_t(2 * k + 1)] = -accIm[size_t(fftSize - k)];
+    }
+    fft.performRealOnlyInverseTransform(fftData.data());
+
+    // the second half is the valid (non-wrapped) part of the circular convolution
+    std::copy(fftData.begin() + blockSize, fftData.begin() + fftSize, outputBlock.begin());
+}
@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+    PartitionedConvolver.h
+    Created: 6 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Uniformly partitioned FFT convolution (overlap-save) for the Color stage,
+    one instance per channel. Every blockSize input samples:
+     - transform [previous block, new block] once and store the spectrum in
+       a frequency-domain delay line (FDL),
+     - multiply-accumulate the FDL against the impulse's partition spectra
+       (precomputed by ImpulseLibrary; split-complex arrays, so the inner
+       loop is plain vectorizable float math),
+     - transform back and keep the last blockSize samples.
+    The latency is exactly blockSize samples. The processor compensates for
+    it by reading the delay lines that much earlier, so echoes stay on time.
+    Input can be fed sample by sample or in blocks of any size.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "ImpulseLibrary.h"
+
+class PartitionedConvolver
+{
+public:
+    static constexpr int latency = ImpulseLibrary::blockSize;
+
+    PartitionedConvolver() = default;
+
+    // Fetch the spectra of every character and size the FDL for the longest one
+    void prepare(double sampleRate);
+    void release();
+    void reset() noexcept;                           // clear the signal history
+
+    // Switch impulse (ImpulseLibrary::Character); keeps the signal history, so it
+    // can change while audio runs
+    void setCharacter(int newCharacter) noexcept;
+
+    float processSample(float input) noexcept;
+    void process(float* io, int numSamples) noexcept; // in place
+
+private:
+    static constexpr int blockSize = ImpulseLibrary::blockSize;
+    static constexpr int fftSize = ImpulseLibrary::fftSize;
+    static constexpr int numBins = ImpulseLibrary::numBins;
+
+    void processPartition() noexcept;
+
+    juce::SharedResourcePointer<ImpulseLibrary> library;
+    std::array<std::shared_ptr<const ImpulseLibrary::Spectra>, ImpulseLibrary::numCharacters> spectra;
+    const ImpulseLibrary::Spectra* active = nullptr;  // spectra[character]
+    int character = ImpulseLibrary::tape;
+
+    juce::dsp::FFT fft { ImpulseLibrary::fftOrder };
+
+    // Frequency-domain delay line: spectrum of input block k - p at slot (fdlIndex - p)
+    std::vector<float> fdlRe, fdlIm;
+    int fdlSlots = 0;
+    int fdlIndex = 0;
+
+    std::array<float, blockSize> previousBlock {};   // overlap-save history
+    std::array<float, blockSize> inputBlock {};
+    std::array<float, blockSize> outputBlock {};     // output of the last full block
+    int position = 0;                                // samples into the current block
+
+    std::array<float, 2 * fftSize> fftData {};
+    std::array<float, numBins> accRe {}, accIm {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PartitionedConvolver)
+};
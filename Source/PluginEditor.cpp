@@ -10,8 +10,14 @@
     - Constructs and lays out rotary knobs, groups, tempo sync button and level meter.
     - Hooks UI controls to the processor's AudioProcessorValueTreeState (attachments).
     - Listens to the tempoSync parameter and toggles delay time / note controls safely
-    on the message thread (uses MessageManager::callAsync when needed).
-    - Paints background using embedded images (BinaryData) and draws the header/logo.
+    on the message thread (changes from other threads are applied on the next UI frame).
+    - Paints background using embedded images (BinaryData) and draws the header/logo,
+    cached as one image per editor size / display scale.
+    - Resizable: layout uses design coordinates, scaled by a transform on each group.
+    - Header holds the preset browser and a Save button for user presets, and the
+    echo Color selector on the right.
+    - Output group holds the A/B morph controls below the gain knob.
+    - Delay group holds the resonator mode toggle below the tempo sync LED.
     - Keeps visual state in sync with audio-side Parameters via the Parameters helpers.
   ==============================================================================
 */
@@ -27,7 +33,9 @@
 DelayAudioProcessorEditor::DelayAudioProcessorEditor (DelayAudioProcessor& p)
     : AudioProcessorEditor (&p),    // base constructor needs processor reference
       audioProcessor (p),           // store reference to the owning processor
-      meter(p.levelL, p.levelR)     // initialize meter with processor's level trackers
+      meter(p.levelL, p.levelR),    // initialize meter with processor's level trackers
+      echoVisualizer(p.wetEnvelope, p.currentDelayTime, p.currentFeedback),
+      spectrumView(p.analyzer, p.params.effectiveLowCut, p.params.effectiveHighCut)
 {
     // Configure the Delay group UI
     delayGroup.setText("Delay");
@@ -43,6 +51,7 @@ DelayAudioProcessorEditor::DelayAudioProcessorEditor (DelayAudioProcessor& p)
     feedbackGroup.addAndMakeVisible(stereoKnob);
     feedbackGroup.addAndMakeVisible(lowCutKnob);
     feedbackGroup.addAndMakeVisible(highCutKnob);
+    feedbackGroup.addAndMakeVisible(spectrumView); // analyzer below the tone knobs
     addAndMakeVisible(feedbackGroup);
 
     // Configure the Output group UI
@@ -51,8 +60,15 @@ DelayAudioProcessorEditor::DelayAudioProcessorEditor (DelayAudioProcessor& p)
     outputGroup.addAndMakeVisible(gainKnob);
     outputGroup.addAndMakeVisible(mixKnob);
     outputGroup.addAndMakeVisible(meter);
+    outputGroup.addAndMakeVisible(morphKnob);
     addAndMakeVisible(outputGroup);
 
+    // Configure the Echoes strip (wet signal visualizer) below the knob groups
+    echoGroup.setText("Echoes");
+    echoGroup.setTextLabelPosition(juce::Justification::horizontallyCentred);
+    echoGroup.addAndMakeVisible(echoVisualizer);
+    addAndMakeVisible(echoGroup);
+
     // Tempo-sync toggle button
     tempoSyncButton.setButtonText("Sync");
     tempoSyncButton.setClickingTogglesState(true); // behaves like a toggle
@@ -70,7 +86,72 @@ DelayAudioProcessorEditor::DelayAudioProcessorEditor (DelayAudioProcessor& p)
     bool initialTempoSync = (audioProcessor.params.tempoSyncParam->get() != 0.0f);
     tempoSyncLight.setState(initialTempoSync);
 
-    setSize(500, 330); // ***** Plug-in fixed window size *****
+    // Resonator mode toggle (below the LED; MIDI notes play the resonator voices)
+    resonatorButton.setButtonText("Reso");
+    resonatorButton.setClickingTogglesState(true);
+    resonatorButton.setBounds(0, 0, 70, 27);
+    resonatorButton.setLookAndFeel(ButtonLookAndFeel::get());
+    delayGroup.addAndMakeVisible(resonatorButton);
+
+    // Color placement toggle (below Reso): color the wet output only instead of the loop
+    colorWetButton.setButtonText("Wet Col");
+    colorWetButton.setClickingTogglesState(true);
+    colorWetButton.setBounds(0, 0, 70, 27);
+    colorWetButton.setLookAndFeel(ButtonLookAndFeel::get());
+    delayGroup.addAndMakeVisible(colorWetButton);
+
+    // Morph slot buttons (momentary: a click stores the current settings) and the On toggle
+    morphAButton.setButtonText("A");
+    morphAButton.onClick = [this] { audioProcessor.storeMorphSlot(Parameters::morphA); updateMorphButtons(); };
+    morphBButton.setButtonText("B");
+    morphBButton.onClick = [this] { audioProcessor.storeMorphSlot(Parameters::morphB); updateMorphButtons(); };
+    morphOnButton.setButtonText("On");
+    morphOnButton.setClickingTogglesState(true);
+    for (auto* button : { &morphAButton, &morphBButton, &morphOnButton }) {
+        button->setLookAndFeel(ButtonLookAndFeel::get());
+        outputGroup.addAndMakeVisible(button);
+    }
+    updateMorphButtons();
+
+    // Preset browser + Save button in the header strip
+    presetBox.setTextWhenNothingSelected("Presets");
+    presetBox.onChange = [this]
+    {
+        int index = presetBox.getSelectedItemIndex();
+        if (index >= 0 && index != audioProcessor.getCurrentProgram()) {
+            audioProcessor.setCurrentProgram(index);
+        }
+    };
+    updatePresetList();
+    addAndMakeVisible(presetBox);
+
+    savePresetButton.setButtonText("Save");
+    savePresetButton.setLookAndFeel(ButtonLookAndFeel::get());
+    savePresetButton.onClick = [this] { showSavePresetDialog(); };
+    addAndMakeVisible(savePresetButton);
+
+    // Parallel channel toggle in the header, next to the color box
+    parallelButton.setButtonText("MT");
+    parallelButton.setClickingTogglesState(true);
+    parallelButton.setToggleState(audioProcessor.getParallelChannels(), juce::dontSendNotification);
+    parallelButton.setLookAndFeel(ButtonLookAndFeel::get());
+    parallelButton.onClick = [this] { audioProcessor.setParallelChannels(parallelButton.getToggleState()); };
+    addAndMakeVisible(parallelButton);
+
+    // Echo color selector (items in parameter order, IDs start at 1 as the attachment expects)
+    if (auto* colorParam = dynamic_cast<juce::AudioParameterChoice*>(
+            audioProcessor.apvts.getParameter(colorParamID.getParamID()))) {
+        colorBox.addItemList(colorParam->choices, 1);
+    }
+    colorAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, colorParamID.getParamID(), colorBox);
+    addAndMakeVisible(colorBox);
+
+    // ***** Resizable plug-in window (fixed aspect ratio, 75% .. 200% of design size) *****
+    setResizable(true, true);
+    setResizeLimits(designWidth * 3 / 4, designHeight * 3 / 4, designWidth * 2, designHeight * 2);
+    getConstrainer()->setFixedAspectRatio(double(designWidth) / double(designHeight));
+    setSize(designWidth, designHeight);
 
     //setLookAndFeel for the entire editor (custom look & feel instance)
     setLookAndFeel(&mainLF);
@@ -85,23 +166,47 @@ DelayAudioProcessorEditor::~DelayAudioProcessorEditor()
 {
     // Clean up listener to avoid dangling callbacks
     audioProcessor.params.tempoSyncParam->removeListener(this);
+    audioProcessor.uiVisible.store(false); // editor closed: stop UI-only metrics on the audio thread
     setLookAndFeel(nullptr); // restore default look & feel before destruction
 }
 
 //==============================================================================
+// The background (image pattern, header strip, logo) is static, so it is rendered
+// once per editor size / display scale into backgroundCache and blitted afterwards.
 void DelayAudioProcessorEditor::paint (juce::Graphics& g)
 {
-  
+    float scaleFactor = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!backgroundCache.isValid() || scaleFactor != backgroundScale) {
+        renderBackground(scaleFactor);
+    }
+    g.drawImage(backgroundCache, getLocalBounds().toFloat());
+}
+
+// Render the background at physical pixel resolution. Drawing happens in design
+// coordinates (designWidth x designHeight) and is scaled to the current editor size.
+void DelayAudioProcessorEditor::renderBackground(float scaleFactor)
+{
+    backgroundScale = scaleFactor;
+    backgroundCache = juce::Image(juce::Image::RGB,
+                                  juce::jmax(1, juce::roundToInt(float(getWidth()) * scaleFactor)),
+                                  juce::jmax(1, juce::roundToInt(float(getHeight()) * scaleFactor)),
+                                  false);
+
+    juce::Graphics g(backgroundCache);
+    g.addTransform(juce::AffineTransform::scale(float(backgroundCache.getWidth()) / float(designWidth),
+                                                float(backgroundCache.getHeight()) / float(designHeight)));
+    auto bounds = juce::Rectangle<int>(designWidth, designHeight);
+
     // Load background image from BinaryData (embedded resource)
     auto Aurora = juce::ImageCache::getFromMemory(
         BinaryData::aurora_png, BinaryData::aurora_pngSize);
     auto fillType = juce::FillType(Aurora, juce::AffineTransform::scale(1.0f));
 
     g.setFillType(fillType);         // set the fill to the image pattern
-    g.fillRect(getLocalBounds());    // paint the background
+    g.fillRect(bounds);              // paint the background
 
     // Draw a header strip
-    auto rect = getLocalBounds().withHeight(40);
+    auto rect = bounds.withHeight(40);
     g.setColour(Colors::header);
     g.fillRect(rect);
 
@@ -112,16 +217,40 @@ void DelayAudioProcessorEditor::paint (juce::Graphics& g)
     int destWidth = image.getWidth() / 2;   // scale down the logo
     int destHeight = image.getHeight() / 2;
     g.drawImage(image,
-                getWidth() / 2 - destWidth / 2, 0, destWidth, destHeight, // destination rect
+                designWidth / 2 - destWidth / 2, 0, destWidth, destHeight, // destination rect
                 0, 0, image.getWidth(), image.getHeight());               // source rect
 }
 
+// Layout is done in fixed design coordinates; each top-level group then gets a scale
+// transform so the whole UI grows with the window. Children render through that
+// transform, so knob and meter caches (keyed on physical pixel scale) stay sharp.
 void DelayAudioProcessorEditor::resized()
 {
-    auto bounds = getLocalBounds();
+    auto bounds = juce::Rectangle<int>(designWidth, designHeight);
+
+    // Only the background depends on the editor size; knob / meter caches pick
+    // the entry for the new scale themselves.
+    backgroundCache = {};
+
+    auto scale = juce::AffineTransform::scale(float(getWidth()) / float(designWidth));
+    delayGroup.setTransform(scale);
+    feedbackGroup.setTransform(scale);
+    outputGroup.setTransform(scale);
+    echoGroup.setTransform(scale);
+    presetBox.setTransform(scale);
+    savePresetButton.setTransform(scale);
+    colorBox.setTransform(scale);
+    parallelButton.setTransform(scale);
+
+    // Header: presets on the left, echo color on the right, logo stays centered
+    presetBox.setBounds(10, 8, 130, 24);
+    savePresetButton.setBounds(presetBox.getRight() + 6, 8, 50, 24);
+    colorBox.setBounds(bounds.getWidth() - 100, 8, 90, 24);
+    parallelButton.setBounds(colorBox.getX() - 46, 8, 40, 24);
 
     int y = 50;     // top margin below header
-    int height = bounds.getHeight() - 60;   // available height for groups
+    int echoHeight = 90;                                   // height of the Echoes strip
+    int height = bounds.getHeight() - 70 - echoHeight;     // available height for groups
 
     // Position the main groups
     delayGroup.setBounds(10, y, 110, height);       // left column
@@ -129,6 +258,7 @@ void DelayAudioProcessorEditor::resized()
     feedbackGroup.setBounds(delayGroup.getRight() + 10, y,                  // middle area
                             outputGroup.getX() - delayGroup.getRight() - 20,
                             height);
+    echoGroup.setBounds(10, delayGroup.getBottom() + 10, bounds.getWidth() - 20, echoHeight);
 
     // Position controls inside their respective groups
     // (absolute positions relative to each "group's" origin)
@@ -137,13 +267,22 @@ void DelayAudioProcessorEditor::resized()
     delayNoteKnob.setTopLeftPosition(delayTimeKnob.getX(), delayTimeKnob.getY());
     mixKnob.setTopLeftPosition(20, 20);
     gainKnob.setTopLeftPosition(mixKnob.getX(), mixKnob.getBottom() + 10);
+    morphKnob.setTopLeftPosition(gainKnob.getX(), gainKnob.getBottom() + 2); // tight: group ends at 370
+    morphAButton.setBounds(morphKnob.getRight() + 5, morphKnob.getY() + 12, 45, 24);
+    morphBButton.setBounds(morphAButton.getX(), morphAButton.getBottom() + 6, 45, 24);
+    morphOnButton.setBounds(morphAButton.getX(), morphBButton.getBottom() + 6, 45, 24);
     feedbackKnob.setTopLeftPosition(20, 20);
     stereoKnob.setTopLeftPosition(feedbackKnob.getRight() + 20, 20);
     lowCutKnob.setTopLeftPosition(feedbackKnob.getX(), feedbackKnob.getBottom() + 10);
     highCutKnob.setTopLeftPosition(lowCutKnob.getRight() + 20, lowCutKnob.getY());
+    spectrumView.setBounds(15, lowCutKnob.getBottom() + 5,
+                           feedbackGroup.getWidth() - 30, feedbackGroup.getHeight() - lowCutKnob.getBottom() - 20);
 
     // Meter positioned inside output group (x is relative to group's left)
     meter.setBounds(outputGroup.getWidth() - 45, 30, 30, gainKnob.getBottom() - 30);
+
+    // Visualizer fills the Echoes group below its label
+    echoVisualizer.setBounds(echoGroup.getLocalBounds().reduced(10, 0).withTrimmedTop(20).withTrimmedBottom(10));
     
     // place LED to the right of the tempo sync button and vertically centered
     tempoSyncLight.setTopLeftPosition(tempoSyncButton.getRight() + 8,
@@ -152,6 +291,10 @@ void DelayAudioProcessorEditor::resized()
     // place LED centered below the tempo sync button with 6 px padding
     tempoSyncLight.setTopLeftPosition( tempoSyncButton.getX() + (tempoSyncButton.getWidth() - 30) / 2,
                                       tempoSyncButton.getBottom() + 30 );
+
+    // resonator mode toggle below the LED
+    resonatorButton.setTopLeftPosition(tempoSyncButton.getX(), tempoSyncLight.getBottom() + 20);
+    colorWetButton.setTopLeftPosition(resonatorButton.getX(), resonatorButton.getBottom() + 10);
 }
 
 // Parameter listener callback (value changed)
@@ -159,16 +302,79 @@ void DelayAudioProcessorEditor::parameterValueChanged(int, float value)
 {
     // If already on the message thread, update immediately
     if (juce::MessageManager::getInstance()->isThisTheMessageThread()) {
+        pendingTempoSync.store(-1);               // drop any older change from another thread
         updateDelayKnobs(value != 0.0f);
         tempoSyncLight.setState(value != 0.0f);   // update LED
     } else {
-        // If called from another thread (audio thread), post to message thread
-        juce::MessageManager::callAsync([this, value]
-        {
-            updateDelayKnobs(value != 0.0f);
-            tempoSyncLight.setState(value != 0.0f);
-        });
+        // If called from another thread (audio thread), leave it for the next UI frame.
+        // Unlike callAsync this allocates nothing and can't outlive the editor.
+        pendingTempoSync.store(value != 0.0f ? 1 : 0);
+    }
+}
+
+// Frame callback from the shared RefreshScheduler: apply a tempoSync change that
+// arrived from a non-message thread since the last frame.
+void DelayAudioProcessorEditor::refresh()
+{
+    int pending = pendingTempoSync.exchange(-1);
+    if (pending >= 0) {
+        updateDelayKnobs(pending != 0);
+        tempoSyncLight.setState(pending != 0);
+    }
+
+    // follow program changes made by the host
+    int program = audioProcessor.getCurrentProgram();
+    if (presetBox.getSelectedItemIndex() != program) {
+        presetBox.setSelectedItemIndex(program, juce::dontSendNotification);
+    }
+
+    updateMorphButtons(); // slots may change when the host restores a state
+
+    // parallel mode is saved with the state, so a restore can change it too
+    parallelButton.setToggleState(audioProcessor.getParallelChannels(), juce::dontSendNotification);
+    parallelButton.setAlpha(audioProcessor.isParallelOverBudget() ? 0.5f : 1.0f);
+}
+
+void DelayAudioProcessorEditor::updateMorphButtons()
+{
+    morphAButton.setToggleState(audioProcessor.params.hasMorphSlot(Parameters::morphA), juce::dontSendNotification);
+    morphBButton.setToggleState(audioProcessor.params.hasMorphSlot(Parameters::morphB), juce::dontSendNotification);
+}
+
+// Fill the preset box from the bank. Item IDs are program index + 1 (0 means "none").
+void DelayAudioProcessorEditor::updatePresetList()
+{
+    presetBox.clear(juce::dontSendNotification);
+    int numPresets = audioProcessor.getNumPrograms();
+    for (int i = 0; i < numPresets; ++i) {
+        presetBox.addItem(audioProcessor.getProgramName(i), i + 1);
     }
+    presetBox.setSelectedItemIndex(audioProcessor.getCurrentProgram(), juce::dontSendNotification);
+}
+
+// Prompt for a preset name; the window deletes itself when dismissed.
+void DelayAudioProcessorEditor::showSavePresetDialog()
+{
+    auto* window = new juce::AlertWindow("Save Preset", "Name for the new user preset:",
+                                         juce::MessageBoxIconType::NoIcon, this);
+    window->addTextEditor("name", presetBox.getText());
+    window->addButton("Save", 1, juce::KeyPress(juce::KeyPress::returnKey));
+    window->addButton("Cancel", 0, juce::KeyPress(juce::KeyPress::escapeKey));
+
+    juce::Component::SafePointer<DelayAudioProcessorEditor> editor(this);
+    window->enterModalState(true, juce::ModalCallbackFunction::create([editor, window](int result)
+    {
+        auto name = window->getTextEditorContents("name").trim();
+        if (editor == nullptr || result == 0 || name.isEmpty()) {
+            return;
+        }
+        if (editor->audioProcessor.saveUserPreset(name) < 0) {
+            juce::AlertWindow::showMessageBoxAsync(juce::MessageBoxIconType::WarningIcon, "Save Preset",
+                                                   "Couldn't save \"" + name + "\". Factory presets are read-only.");
+            return;
+        }
+        editor->updatePresetList();
+    }), true);
 }
 
 // Toggle visibility of manual vs. note-based delay controls based on tempo sync state
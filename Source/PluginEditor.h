@@ -17,6 +17,10 @@
 #include "LookAndFeel.h"         // custom LookAndFeel implementations
 #include "LevelMeter.h"          // simple level meter widget
 #include "LedLight.h"            // Led light when "sync" activated
+#include "EchoVisualizer.h"      // scrolling view of the echo train
+#include "SpectrumView.h"        // input vs. feedback-path analyzer overlay
+#include "RefreshScheduler.h"    // shared per-frame UI clock
+#include "ResourcePreloader.h"   // decodes typeface / images off the message thread
 
 //==============================================================================
 /*
@@ -39,11 +43,23 @@ private:
     void parameterGestureChanged(int, bool) override { }  // gesture begin/end (unused here)
 
     void updateDelayKnobs(bool tempoSyncActive); // helper to enable/disable or update delay-related knobs
+    void refresh();                              // per-frame callback: applies pending tempoSync changes
+    void renderBackground(float scaleFactor);    // draw background/header/logo into backgroundCache
+    void updatePresetList();                     // refill presetBox from the shared bank
+    void showSavePresetDialog();                 // ask for a name, then save a user preset
+    void updateMorphButtons();                   // light A / B when their slot is filled
+
+    // Layout size at 100% scale; the editor is resizable with a fixed aspect ratio
+    static constexpr int designWidth = 500;
+    static constexpr int designHeight = 530;
 
     // This reference is provided as a quick way for your editor to
     // access the processor object that created it.
     DelayAudioProcessor& audioProcessor; // ref to owning processor (must outlive editor)
 
+    // Declared first so decoding starts before the knobs etc. are constructed
+    ResourcePreloader preloader;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DelayAudioProcessorEditor)
     // disallow copying and enable leak detection in debug builds
 
@@ -59,6 +75,7 @@ private:
     RotaryKnob lowCutKnob { "Low Cut", audioProcessor.apvts, lowCutParamID };     // tone control - low cut
     RotaryKnob highCutKnob { "High Cut", audioProcessor.apvts, highCutParamID };  // tone control - high cut
     RotaryKnob delayNoteKnob { "Note", audioProcessor.apvts, delayNoteParamID };  // note choice for tempo sync
+    RotaryKnob morphKnob { "Morph", audioProcessor.apvts, morphParamID };         // A -> B morph amount
 
     juce::TextButton tempoSyncButton; // toggle button for tempo sync on/off
 
@@ -68,11 +85,61 @@ private:
     };
     
     LedLight tempoSyncLight;    // New: visual indicator for tempo-sync state
+
+    // Resonator mode on / off (MIDI notes play Karplus-Strong voices)
+    juce::TextButton resonatorButton;
+    juce::AudioProcessorValueTreeState::ButtonAttachment resonatorAttachment {
+        audioProcessor.apvts, resonatorParamID.getParamID(), resonatorButton
+    };
+
+    // Color placement: lit = Color on the wet output only, off = in the feedback loop
+    juce::TextButton colorWetButton;
+    juce::AudioProcessorValueTreeState::ButtonAttachment colorWetAttachment {
+        audioProcessor.apvts, colorPlacementParamID.getParamID(), colorWetButton
+    };
+
+    // Morph: A / B store the current settings in a slot (lit when the slot is filled),
+    // On engages morphing between the two
+    juce::TextButton morphAButton, morphBButton, morphOnButton;
+    juce::AudioProcessorValueTreeState::ButtonAttachment morphOnAttachment {
+        audioProcessor.apvts, morphOnParamID.getParamID(), morphOnButton
+    };
     
     juce::GroupComponent delayGroup, feedbackGroup, outputGroup; // grouped UI panels
+    juce::GroupComponent echoGroup;                               // bottom strip with the visualizer
+
+    juce::ComboBox presetBox;      // preset browser in the header (host programs)
+
+    // Echo color (Clean / Tape / Spring) on the right of the header. The attachment is
+    // created once the box has its items.
+    juce::ComboBox colorBox;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> colorAttachment;
+    juce::TextButton savePresetButton;
+
+    // Parallel channel mode (processor setting, not a parameter: applies at the next
+    // prepareToPlay). Dimmed when the worker missed its latency budget.
+    juce::TextButton parallelButton;
 
     MainLookAndFeel mainLF; // instance of custom look-and-feel for the editor
 
     LevelMeter meter; // visual level meter (single instance shown in the UI)
 
+    juce::Image backgroundCache;   // pre-rendered background for the current size / display scale
+    float backgroundScale = 0.0f;  // physical pixel scale backgroundCache was rendered at
+
+    EchoVisualizer echoVisualizer; // wet-signal envelope with feedback repeat markers
+
+    SpectrumView spectrumView;     // analyzer overlay in the Feedback group
+
+    // tempoSync state posted by parameterValueChanged (-1 = nothing pending). Written from
+    // whichever thread the host automates on, consumed once per frame on the message thread.
+    std::atomic<int> pendingTempoSync { -1 };
+
+    // Per-frame updates driven by the shared scheduler (declared last: it calls refresh()).
+    // Also tells the processor whether anybody can see the UI, so the audio thread can
+    // skip metering / visualizer work while the editor is hidden or minimised.
+    RefreshScheduler::Attachment refreshAttachment {
+        *this, [this] { refresh(); },
+        [this](bool showing) { audioProcessor.uiVisible.store(showing); }
+    };
 };
@@ -11,10 +11,17 @@
      - Hosts the AudioProcessorValueTreeState (apvts) and Parameters helper for smoothing,
        parameter updates, and attachments used by the editor.
      - Allocates and manages delay lines, per-channel feedback, and filter state.
+       Delay buffers come from the process-wide BufferPool and go back to it in
+       releaseResources.
      - Implements processBlock: reads inputs, applies delay (tempo-syncable), feedback,
        filtering, mixing, gain, and level measurement; protects against denormals and
-       unsafe sample values in debug builds.
-     - Handles state save/restore (getStateInformation / setStateInformation) and plugin instantiation.
+       unsafe sample values in debug builds. Control values are computed per block as
+       ramps; with the optional parallel mode the two channels' delay read + feedback
+       filtering runs on separate cores when the delay is longer than the block.
+     - Handles state save/restore (getStateInformation / setStateInformation, compact binary
+       ValueTree format with XML fallback for older sessions) and plugin instantiation.
+     - Exposes the shared PresetBank as host programs (load / save presets).
+     - Keeps the A/B morph slots in the APVTS state so they are saved with the session.
 
   =====================================================================================================
 */
@@ -22,6 +29,7 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "ProtectYourEars.h"
+#include "OutputKernels.h"
 
 //==============================================================================
 // Implementation of the audio processor
@@ -34,8 +42,12 @@ DelayAudioProcessor::DelayAudioProcessor() :
     params(apvts) // initialize Parameters helper with the APVTS instance
 {
     // Set filter types used later in the feedback path
-    lowCutFilter.setType(juce::dsp::StateVariableTPTFilterType::highpass);
-    highCutFilter.setType(juce::dsp::StateVariableTPTFilterType::lowpass);
+    for (auto& filter : lowCutFilters) {
+        filter.setType(TptFilter::Type::highpass);
+    }
+    for (auto& filter : highCutFilters) {
+        filter.setType(TptFilter::Type::lowpass);
+    }
 }
 
 DelayAudioProcessor::~DelayAudioProcessor()
@@ -82,25 +94,86 @@ double DelayAudioProcessor::getTailLengthSeconds() const
 
 int DelayAudioProcessor::getNumPrograms()
 {
-    return 1;   // keep at least one program for host compatibility
+    return juce::jmax(1, presetBank->getNumPresets()); // hosts expect at least one program
 }
 
 int DelayAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return currentProgram.load();
 }
 
+// Load a preset: the audio thread gets the whole snapshot in one block via publish(),
+// then the parameters are set so the host, the editor and later blocks agree with it.
 void DelayAudioProcessor::setCurrentProgram (int index)
 {
+    Parameters::Snapshot snapshot;
+    if (presetBank->getSnapshot(index, snapshot)) {
+        params.publish(snapshot);
+        params.applyToHost(snapshot);
+        currentProgram.store(index);
+    }
 }
 
 const juce::String DelayAudioProcessor::getProgramName (int index)
 {
-    return {};
+    return presetBank->getName(index);
 }
 
 void DelayAudioProcessor::changeProgramName (int index, const juce::String& newName)
 {
+    // Presets are renamed by saving under the new name; the bank is shared, so a
+    // host renaming a program here would silently change it for every instance.
+    juce::ignoreUnused(index, newName);
+}
+
+int DelayAudioProcessor::saveUserPreset(const juce::String& name)
+{
+    int index = presetBank->saveUserPreset(name, params.capture());
+    if (index >= 0) {
+        currentProgram.store(index);
+        updateHostDisplay(ChangeDetails().withProgramChanged(true)); // program list changed
+    }
+    return index;
+}
+
+// Morph slots are stored as properties of apvts.state holding the raw snapshot
+// floats, so they travel with getStateInformation like the parameters do.
+static const juce::Identifier morphSlotIDs[] = { "morphA", "morphB" };
+static const juce::Identifier parallelChannelsID { "parallelChannels" };
+
+void DelayAudioProcessor::storeMorphSlot(int slot)
+{
+    auto snapshot = params.capture();
+    params.setMorphSlot(slot, snapshot);
+    apvts.state.setProperty(morphSlotIDs[slot],
+                            juce::MemoryBlock(snapshot.values.data(), sizeof(snapshot.values)), nullptr);
+}
+
+void DelayAudioProcessor::setParallelChannels(bool enabled)
+{
+    parallelChannels.store(enabled);
+    apvts.state.setProperty(parallelChannelsID, enabled, nullptr);
+}
+
+void DelayAudioProcessor::restoreExtraState()
+{
+    parallelChannels.store(bool(apvts.state.getProperty(parallelChannelsID, false)));
+
+    // The snapshot is append-only: a slot saved before values were appended is shorter.
+    // Copy what is there over the defaults (as PresetBank::migrateBank does); only a
+    // blob that isn't whole floats is dropped. A longer one (newer version) keeps the
+    // values this version knows.
+    for (int slot = 0; slot < Parameters::numMorphSlots; ++slot) {
+        auto* block = apvts.state.getProperty(morphSlotIDs[slot]).getBinaryData();
+        if (block != nullptr && block->getSize() > 0 && block->getSize() % sizeof(float) == 0) {
+            auto snapshot = Parameters::getDefaults();
+            std::memcpy(snapshot.values.data(), block->getData(),
+                        std::min(block->getSize(), sizeof(snapshot.values)));
+            params.setMorphSlot(slot, snapshot);
+        } else {
+            params.clearMorphSlot(slot);
+        }
+    }
 }
 
 //==============================================================================
@@ -109,16 +182,17 @@ void DelayAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     params.prepareToPlay(sampleRate); // initialize smoothers etc.
     params.reset();                   // set initial parameter values
 
-    juce::dsp::ProcessSpec spec;
-    spec.sampleRate = sampleRate;
-    spec.maximumBlockSize = juce::uint32(samplesPerBlock);
-    spec.numChannels = 2; // we expect stereo processing
-
     // compute maximum delay buffer size from max delay time (ms -> samples)
     double numSamples = Parameters::maxDelayTime / 1000.0 * sampleRate;
     int maxDelayInSamples = int(std::ceil(numSamples));
 
-    delayLineL.setMaximumDelayInSamples(maxDelayInSamples); // allocate / set cap
+    // Reserve for the highest sample rate up front, so a host switching sample rates
+    // never makes prepareToPlay allocate. Unwritten pages cost no physical memory.
+    int reservedDelayInSamples = int(std::ceil(Parameters::maxDelayTime / 1000.0 * maxExpectedSampleRate));
+    delayLineL.reserve(juce::jmax(maxDelayInSamples, reservedDelayInSamples));
+    delayLineR.reserve(juce::jmax(maxDelayInSamples, reservedDelayInSamples));
+
+    delayLineL.setMaximumDelayInSamples(maxDelayInSamples); // set active length (no allocation)
     delayLineR.setMaximumDelayInSamples(maxDelayInSamples);
     delayLineL.reset();
     delayLineR.reset();
@@ -127,12 +201,15 @@ void DelayAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
     feedbackL = 0.0f;
     feedbackR = 0.0f;
 
-    // prepare filters with the process spec and clear their state
-    lowCutFilter.prepare(spec);
-    lowCutFilter.reset();
-
-    highCutFilter.prepare(spec);
-    highCutFilter.reset();
+    // prepare filters for the sample rate and clear their state (one filter object per channel)
+    for (auto& filter : lowCutFilters) {
+        filter.prepare(sampleRate);
+        filter.reset();
+    }
+    for (auto& filter : highCutFilters) {
+        filter.prepare(sampleRate);
+        filter.reset();
+    }
 
     // cached cutoff values to detect changes and avoid redundant set calls
     lastLowCut = -1.0f;
@@ -142,11 +219,63 @@ void DelayAudioProcessor::prepareToPlay (double sampleRate, int samplesPerBlock)
 
     levelL.reset(); // reset level meters/measurement
     levelR.reset();
+
+    wetEnvelope.prepare(sampleRate); // decimation factor for the echo visualizer
+
+    analyzer.prepare(sampleRate);
+    // allocate here, never on the audio thread; keeps the allocation when the block size shrinks
+    analyzerScratch.setSize(2, samplesPerBlock, false, false, true);
+    // the default engine only touches the first subBlockSize samples of these
+    int scratchSize = juce::jmax(subBlockSize, samplesPerBlock);
+    ramps.setSize(numRamps, scratchSize, false, false, true);
+    wetBlock.setSize(2, scratchSize, false, false, true);
+    feedbackBlock.setSize(2, scratchSize, false, false, true);
+    writeBlock.setSize(2, scratchSize, false, false, true);
+    resonatorBlock.setSize(1, scratchSize, false, false, true);
+
+    resonator.prepare(sampleRate, maxExpectedSampleRate); // ring reserved like the delay lines
+    resonatorActive = false;
+
+    for (auto& convolver : convolvers) {
+        convolver.prepare(sampleRate); // impulse spectra are shared by all instances
+    }
+    activeColor = 0;
+
+    // one worker for the second channel; waiting for it may take a small part of the block,
+    // and it keeps polling for jobs until the host has skipped a few blocks
+    double blockPeriodMs = 1000.0 * samplesPerBlock / sampleRate;
+    workerPool.prepare(parallelChannels.load() ? 2 : 0, parallelBudget * blockPeriodMs,
+                       parallelIdleBlocks * blockPeriodMs);
 }
 
 void DelayAudioProcessor::releaseResources()
 {
-    // free resources if needed when playback stops
+    // give the delay buffers back to the shared pool; prepareToPlay takes them again
+    // (straight from the pool's cache if it happens within BufferPool::cacheHoldTime)
+    delayLineL.release();
+    delayLineR.release();
+
+    // drop filter / feedback state and the analyzer scratch buffer
+    for (auto& filter : lowCutFilters) {
+        filter.reset();
+    }
+    for (auto& filter : highCutFilters) {
+        filter.reset();
+    }
+    feedbackL = 0.0f;
+    feedbackR = 0.0f;
+    analyzerScratch.setSize(0, 0);
+    workerPool.release();
+    resonator.release();
+    for (auto& convolver : convolvers) {
+        convolver.release();
+    }
+}
+
+// Session-wide delay buffer memory (all instances), for debugging / profiling.
+BufferPool::Stats DelayAudioProcessor::getMemoryStats() const
+{
+    return bufferPool->getStats();
 }
 
 bool DelayAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -170,7 +299,7 @@ bool DelayAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) con
 //
 // *******************************************************************************
 
-void DelayAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, [[maybe_unused]] juce::MidiBuffer& midiMessages)
+void DelayAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals; // avoid denormals on some CPUs
     auto totalNumInputChannels  = getTotalNumInputChannels();
@@ -180,6 +309,12 @@ void DelayAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, [[mayb
     for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
         buffer.clear (i, 0, buffer.getNumSamples());
 
+    // no delay buffers between releaseResources and the next prepareToPlay
+    if (delayLineL.getBufferLength() == 0) {
+        buffer.clear();
+        return;
+    }
+
     params.update();                 // pull latest parameter values from APVTS
     tempo.update(getPlayHead());     // update tempo from host playhead if available
 
@@ -204,73 +339,409 @@ void DelayAudioProcessor::processBlock (juce::AudioBuffer<float>& buffer, [[mayb
     float* outputDataL = mainOutput.getWritePointer(0);
     float* outputDataR = mainOutput.getWritePointer(isMainOutputStereo ? 1 : 0);
 
-    float maxL = 0.0f; // peak trackers for meters
-    float maxR = 0.0f;
+    BlockState state;
+    state.inputDataL = inputDataL;
+    state.inputDataR = inputDataR;
+    state.outputDataL = outputDataL;
+    state.outputDataR = outputDataR;
+    state.syncedTime = syncedTime;
+    state.sampleRate = sampleRate;
+
+    // Meters / visualizers only need feeding while somebody can see them
+    state.uiActive = uiVisible.load(std::memory_order_relaxed);
+
+    // analyzer samples are staged here and handed over with one copy after the loop
+    int numSamples = buffer.getNumSamples();
+    state.analyzerSamples = state.uiActive ? std::min(numSamples, analyzerScratch.getNumSamples()) : 0;
+    state.analyzerInput = analyzerScratch.getWritePointer(0);
+    state.analyzerFeedback = analyzerScratch.getWritePointer(1);
+
+    state.parallel = parallelChannels.load(std::memory_order_relaxed) && workerPool.getNumWorkers() > 0;
+
+    // Color stage: switching it on starts from a silent history; switching between
+    // characters keeps it (only the impulse changes). The read-ahead follows through
+    // the delay smoother, so the read position glides instead of jumping.
+    if (params.color != activeColor) {
+        for (auto& convolver : convolvers) {
+            if (activeColor == 0) {
+                convolver.reset();
+            }
+            if (params.color > 0) {
+                convolver.setCharacter(params.color - 1);
+            }
+        }
+        activeColor = params.color;
+    }
+    colorInLoop = params.colorInLoop;
+    params.setReadAhead(activeColor > 0 ? float(PartitionedConvolver::latency) : 0.0f);
+
+    // Resonator mode: switching it on or off drops all voices, so nothing stale
+    // (or a note whose note-off arrived while it was off) sounds later
+    state.midi = &midiMessages;
+    state.resonator = params.resonator;
+    if (state.resonator != resonatorActive) {
+        resonator.reset();
+        resonatorActive = state.resonator;
+    }
+
+    // Sub-block scheduler: whatever the host block size, the engine runs in fixed chunks
+    // of subBlockSize samples, so the ramps and wet / feedback scratch stay in L1 and the
+    // full-size chunks run through kernels specialised on that size. The parallel mode
+    // uses chunks as long as the prepared block instead: splitting channels only pays
+    // off for long runs.
+    const int chunkLimit = state.parallel ? ramps.getNumSamples() : subBlockSize;
+    for (int offset = 0; offset < numSamples; offset += chunkLimit) {
+        int chunkSize = std::min(numSamples - offset, chunkLimit);
+        if (chunkSize == subBlockSize) {
+            processChunk<subBlockSize>(state, offset, subBlockSize);
+        } else {
+            processChunk<0>(state, offset, chunkSize);
+        }
+    }
+
+#if JUCE_DEBUG
+    protectYourEars(buffer); // debug guard to catch NaN/Inf/clipping during development
+#endif
+
+    if (state.uiActive) {
+        // update measurement objects with observed peaks
+        levelL.updateIfGreater(state.maxL);
+        levelR.updateIfGreater(state.maxR);
+
+        // publish this block's envelope frames and echo spacing to the visualizer
+        wetEnvelope.flush();
+        currentDelayTime.store(state.delayTime);
+        currentFeedback.store(params.feedback);
 
-    // per-sample processing loop (keeps smoothing/controls sample-accurate)
-    for (int sample = 0; sample < buffer.getNumSamples(); ++sample) {
+        analyzer.push(state.analyzerInput, state.analyzerFeedback, state.analyzerSamples); // copy only; FFT runs on the worker
+    }
+}
+
+// Advance the smoothers through the chunk and keep every per-sample control value.
+// FixedSize > 0 makes the trip count a compile-time constant (full sub-blocks).
+template <int FixedSize>
+void DelayAudioProcessor::computeRamps(int numSamples, float syncedTime, float sampleRate) noexcept
+{
+    const int n = FixedSize > 0 ? FixedSize : numSamples;
+
+    float* delay = ramps.getWritePointer(delayRamp);
+    float* feedback = ramps.getWritePointer(feedbackRamp);
+    float* panL = ramps.getWritePointer(panLRamp);
+    float* panR = ramps.getWritePointer(panRRamp);
+    float* mix = ramps.getWritePointer(mixRamp);
+    float* gain = ramps.getWritePointer(gainRamp);
+    float* lowCut = ramps.getWritePointer(lowCutRamp);
+    float* highCut = ramps.getWritePointer(highCutRamp);
+    float* loopDelay = ramps.getWritePointer(loopDelayRamp);
+
+    for (int i = 0; i < n; ++i) {
         params.smoothen(); // advance smoothers and compute current param values
 
         // choose delay time (tempo-synced or manual) and convert to samples
         float delayTime = params.tempoSync ? syncedTime : params.delayTime;
-        float delayInSamples = delayTime / 1000.0f * sampleRate;
+        // read earlier by the Color latency, but never ahead of the write position (at
+        // low sample rates the shortest delays are shorter than the latency)
+        loopDelay[i] = delayTime / 1000.0f * sampleRate;
+        delay[i] = std::max(loopDelay[i] - params.readAhead, 1.0f);
+
+        feedback[i] = params.feedback;
+        panL[i] = params.panL;
+        panR[i] = params.panR;
+        mix[i] = params.mix;
+        gain[i] = params.gain;
+        lowCut[i] = params.lowCut;
+        highCut[i] = params.highCut;
+    }
+}
+
+// One chunk of the engine: control ramps, delay / feedback path, then the output stage.
+template <int FixedSize>
+void DelayAudioProcessor::processChunk(BlockState& state, int offset, int numSamples) noexcept
+{
+    const int n = FixedSize > 0 ? FixedSize : numSamples;
+
+    computeRamps<FixedSize>(n, state.syncedTime, state.sampleRate);
+    state.delayTime = ramps.getSample(loopDelayRamp, n - 1) * 1000.0f / state.sampleRate;
+
+    const float* inputDataL = state.inputDataL + offset;
+    const float* inputDataR = state.inputDataR + offset;
+
+    // The block engine works when no sample read in this chunk is written in it, which
+    // is every delay above ~1.5 ms at 44.1 kHz with 64-sample chunks. Only shorter
+    // delays fall back to the per-sample loop. Splitting channels across the worker
+    // pool only pays off for long blocks.
+    auto delayRange = juce::FloatVectorOperations::findMinAndMax(ramps.getReadPointer(delayRamp), n);
+
+    if (delayRange.getStart() >= float(n + 1)) {
+        bool parallel = state.parallel && n >= ChannelWorkerPool::minBlockSize;
+        bool constantDelay = delayRange.getStart() == delayRange.getEnd(); // smoother settled
+        processBlockPass(inputDataL, inputDataR, n, parallel, constantDelay);
+    } else {
+        processPerSample(inputDataL, inputDataR, n);
+    }
 
-        // update filters only when cutoff changed to save CPU
-        if (params.lowCut != lastLowCut) {
-            lowCutFilter.setCutoffFrequency(params.lowCut);
-            lastLowCut = params.lowCut;
+    if (state.resonator) {
+        processResonator(state, offset, n);
+    }
+
+    const float* wetL = wetBlock.getReadPointer(0);
+    const float* wetR = wetBlock.getReadPointer(1);
+    const float* mix = ramps.getReadPointer(mixRamp);
+    const float* gain = ramps.getReadPointer(gainRamp);
+    float* outputDataL = state.outputDataL + offset;
+    float* outputDataR = state.outputDataR + offset;
+
+    if (state.uiActive) {
+        // analyzer feed (mono sums of dry input and feedback path), staged before the
+        // output stage overwrites the input
+        int analyzerCount = juce::jlimit(0, n, state.analyzerSamples - offset);
+        if (analyzerCount > 0) {
+            float* analyzerInput = state.analyzerInput + offset;
+            float* analyzerFeedback = state.analyzerFeedback + offset;
+            juce::FloatVectorOperations::add(analyzerInput, inputDataL, inputDataR, analyzerCount);
+            juce::FloatVectorOperations::multiply(analyzerInput, 0.5f, analyzerCount);
+            juce::FloatVectorOperations::add(analyzerFeedback, feedbackBlock.getReadPointer(0),
+                                             feedbackBlock.getReadPointer(1), analyzerCount);
+            juce::FloatVectorOperations::multiply(analyzerFeedback, 0.5f, analyzerCount);
         }
-        if (params.highCut != lastHighCut) {
-            highCutFilter.setCutoffFrequency(params.highCut);
-            lastHighCut = params.highCut;
+
+        // wet signal envelope for the echo visualizer (mono sum)
+        for (int i = 0; i < n; ++i) {
+            wetEnvelope.pushSample((wetL[i] + wetR[i]) * 0.5f);
         }
+    }
 
-        // read dry input samples (supports mono input by duplicating channel 0)
-        float dryL = inputDataL[sample];
-        float dryR = inputDataR[sample];
+    // Output stage: mix dry + wet according to mix param and apply output gain, with the
+    // kernels from OutputKernels.h. Right goes first: with a mono input both channels read
+    // channel 0, which the left channel then overwrites in place. With a mono output both
+    // pointers are channel 0 and only the right channel is rendered (as before, where the
+    // right channel's write came last).
+    mixChannel(outputDataR, inputDataR, wetR, mix, gain, n);
+    if (outputDataL != outputDataR) {
+        jassert(inputDataL != outputDataR); // would need the left input staged first
+        mixChannel(outputDataL, inputDataL, wetL, mix, gain, n);
+    }
 
-        float mono = (dryL + dryR) * 0.5f; // use mono sum for the delay write
+    if (state.uiActive) {
+        // track peaks for meters
+        auto rangeL = juce::FloatVectorOperations::findMinAndMax(outputDataL, n);
+        auto rangeR = juce::FloatVectorOperations::findMinAndMax(outputDataR, n);
+        state.maxL = std::max({ state.maxL, rangeL.getEnd(), -rangeL.getStart() });
+        state.maxR = std::max({ state.maxR, rangeR.getEnd(), -rangeR.getStart() });
+    }
+}
+
+// Resonator mode for one chunk: apply the chunk's MIDI events (so notes start with up
+// to one sub-block of jitter), excite the voices with the mono input, and add their
+// output to both wet channels. Damping and loop gain follow the feedback section.
+void DelayAudioProcessor::processResonator(BlockState& state, int offset, int numSamples) noexcept
+{
+    const auto& midi = *state.midi;
+    for (auto it = midi.findNextSamplePosition(offset); it != midi.cend(); ++it) {
+        const auto metadata = *it;
+        if (metadata.samplePosition >= offset + numSamples) {
+            break;
+        }
+
+        const auto message = metadata.getMessage();
+        if (message.isNoteOn()) {
+            resonator.noteOn(message.getNoteNumber(), message.getFloatVelocity());
+        } else if (message.isNoteOff()) {
+            resonator.noteOff(message.getNoteNumber());
+        } else if (message.isAllNotesOff() || message.isAllSoundOff()) {
+            resonator.allNotesOff();
+        }
+    }
+
+    float* voices = resonatorBlock.getWritePointer(0);
+    juce::FloatVectorOperations::add(voices, state.inputDataL + offset, state.inputDataR + offset, numSamples);
+    juce::FloatVectorOperations::multiply(voices, 0.5f, numSamples);
+
+    int last = numSamples - 1;
+    resonator.setDamping(ramps.getSample(lowCutRamp, last), ramps.getSample(highCutRamp, last));
+    resonator.process(voices, numSamples, ramps.getSample(feedbackRamp, last));
+
+    juce::FloatVectorOperations::add(wetBlock.getWritePointer(0), voices, numSamples);
+    juce::FloatVectorOperations::add(wetBlock.getWritePointer(1), voices, numSamples);
+}
+
+// update filters only when cutoff changed to save CPU
+void DelayAudioProcessor::setFilterCutoffs(float lowCut, float highCut) noexcept
+{
+    if (lowCut != lastLowCut) {
+        for (auto& filter : lowCutFilters) {
+            filter.setCutoffFrequency(lowCut);
+        }
+        lastLowCut = lowCut;
+    }
+    if (highCut != lastHighCut) {
+        for (auto& filter : highCutFilters) {
+            filter.setCutoffFrequency(highCut);
+        }
+        lastHighCut = highCut;
+    }
+}
+
+// Original per-sample loop: write, read, filter, one sample at a time (sample-accurate
+// cutoff updates). Leaves the wet and filtered feedback signals in wetBlock / feedbackBlock.
+void DelayAudioProcessor::processPerSample(const float* inputDataL, const float* inputDataR, int numSamples) noexcept
+{
+    const float* delay = ramps.getReadPointer(delayRamp);
+    const float* loopDelay = ramps.getReadPointer(loopDelayRamp);
+    const float* feedback = ramps.getReadPointer(feedbackRamp);
+    const float* panL = ramps.getReadPointer(panLRamp);
+    const float* panR = ramps.getReadPointer(panRRamp);
+    const float* lowCut = ramps.getReadPointer(lowCutRamp);
+    const float* highCut = ramps.getReadPointer(highCutRamp);
+    float* wetL = wetBlock.getWritePointer(0);
+    float* wetR = wetBlock.getWritePointer(1);
+    float* filteredL = feedbackBlock.getWritePointer(0);
+    float* filteredR = feedbackBlock.getWritePointer(1);
+
+    for (int i = 0; i < numSamples; ++i) {
+        setFilterCutoffs(lowCut[i], highCut[i]);
+
+        float mono = (inputDataL[i] + inputDataR[i]) * 0.5f; // use mono sum for the delay write
 
         // write into delay lines with panning + cross-feedback
-        delayLineL.write(mono*params.panL + feedbackR);
-        delayLineR.write(mono*params.panR + feedbackL);
+        delayLineL.write(mono*panL[i] + feedbackR);
+        delayLineR.write(mono*panR[i] + feedbackL);
 
         // read delayed samples (fractional-read supported by DelayLine)
-        float wetL = delayLineL.read(delayInSamples);
-        float wetR = delayLineR.read(delayInSamples);
+        wetL[i] = delayLineL.read(delay[i]);
+        wetR[i] = delayLineR.read(delay[i]);
+        float loopL = wetL[i];
+        float loopR = wetR[i];
+        if (activeColor > 0) {
+            wetL[i] = convolvers[0].processSample(wetL[i]);
+            wetR[i] = convolvers[1].processSample(wetR[i]);
+            if (colorInLoop) {
+                loopL = wetL[i];
+                loopR = wetR[i];
+            } else {
+                loopL = delayLineL.read(loopDelay[i]); // clean repeats at the full delay
+                loopR = delayLineR.read(loopDelay[i]);
+            }
+        }
 
         // compute feedback paths and run through tone filters
-        feedbackL = wetL * params.feedback;
-        feedbackL = lowCutFilter.processSample(0, feedbackL);
-        feedbackL = highCutFilter.processSample(0, feedbackL);
+        feedbackL = loopL * feedback[i];
+        feedbackL = lowCutFilters[0].processSample(feedbackL);
+        feedbackL = highCutFilters[0].processSample(feedbackL);
 
-        feedbackR = wetR * params.feedback;
-        feedbackR = lowCutFilter.processSample(1, feedbackR);
-        feedbackR = highCutFilter.processSample(1, feedbackR);
+        feedbackR = loopR * feedback[i];
+        feedbackR = lowCutFilters[1].processSample(feedbackR);
+        feedbackR = highCutFilters[1].processSample(feedbackR);
 
-        // mix dry + wet according to mix param and apply output gain
-        float mixL = dryL + wetL * params.mix;
-        float mixR = dryR + wetR * params.mix;
+        filteredL[i] = feedbackL;
+        filteredR[i] = feedbackR;
+    }
+}
 
-        float outL = mixL * params.gain;
-        float outR = mixR * params.gain;
+// Block engine. Phase 1 reads each channel's wet block and runs its feedback filters;
+// the channels don't touch each other's data, so with parallel = true they are split
+// across the worker pool. Phase 2 writes both delay lines (cross-feedback needs both
+// channels) on this thread. Each write uses the previous sample's feedback, exactly
+// like the per-sample loop; reads never see this block's writes (delay >= block + 1).
+// Only the filters are still sample by sample (they are recursive); the reads, the
+// write signal and the writes themselves are block operations.
+void DelayAudioProcessor::processBlockPass(const float* inputDataL, const float* inputDataR,
+                                           int numSamples, bool parallel, bool constantDelay) noexcept
+{
+    // cutoffs are updated once per block here
+    setFilterCutoffs(ramps.getSample(lowCutRamp, numSamples - 1), ramps.getSample(highCutRamp, numSamples - 1));
+
+    channelJob.delays = ramps.getReadPointer(delayRamp);
+    channelJob.loopDelays = ramps.getReadPointer(loopDelayRamp);
+    channelJob.feedback = ramps.getReadPointer(feedbackRamp);
+    channelJob.numSamples = numSamples;
+    channelJob.constantDelay = constantDelay;
+    channelJob.constantLoopDelay = false;
+    if (activeColor > 0 && !colorInLoop) {      // feedback has its own read
+        auto loopRange = juce::FloatVectorOperations::findMinAndMax(channelJob.loopDelays, numSamples);
+        channelJob.constantLoopDelay = loopRange.getStart() == loopRange.getEnd();
+    }
+    for (int channel = 0; channel < 2; ++channel) {
+        channelJob.wet[channel] = wetBlock.getWritePointer(channel);
+        channelJob.filtered[channel] = feedbackBlock.getWritePointer(channel);
+    }
 
-        // write output samples
-        outputDataL[sample] = outL;
-        outputDataR[sample] = outR;
+    if (parallel) {
+        workerPool.run(&processChannel, this, 2);
+    } else {
+        processChannel(this, 0);
+        processChannel(this, 1);
+    }
 
-        // track peaks for meters
-        maxL = std::max(maxL, std::abs(outL));
-        maxR = std::max(maxR, std::abs(outR));
+    const float* panL = ramps.getReadPointer(panLRamp);
+    const float* panR = ramps.getReadPointer(panRRamp);
+    const float* filteredL = feedbackBlock.getReadPointer(0);
+    const float* filteredR = feedbackBlock.getReadPointer(1);
+
+    float* writeL = writeBlock.getWritePointer(0);
+    float* writeR = writeBlock.getWritePointer(1);
+
+    // mono sum, panned into each line
+    juce::FloatVectorOperations::add(writeR, inputDataL, inputDataR, numSamples);
+    juce::FloatVectorOperations::multiply(writeR, 0.5f, numSamples);
+    juce::FloatVectorOperations::multiply(writeL, writeR, panL, numSamples);
+    juce::FloatVectorOperations::multiply(writeR, panR, numSamples);
+
+    // cross-feedback, one sample late: sample i gets the other channel's filtered i - 1,
+    // sample 0 the last value of the previous block
+    writeL[0] += feedbackR;
+    writeR[0] += feedbackL;
+    if (numSamples > 1) {
+        juce::FloatVectorOperations::add(writeL + 1, filteredR, numSamples - 1);
+        juce::FloatVectorOperations::add(writeR + 1, filteredL, numSamples - 1);
     }
 
-#if JUCE_DEBUG
-    protectYourEars(buffer); // debug guard to catch NaN/Inf/clipping during development
-#endif
+    delayLineL.writeBlock(writeL, numSamples);
+    delayLineR.writeBlock(writeR, numSamples);
+
+    feedbackL = filteredL[numSamples - 1];
+    feedbackR = filteredR[numSamples - 1];
+}
+
+// One channel of phase 1 (may run on a worker thread): only touches this channel's
+// delay line (read-only), convolver, filters and output blocks.
+void DelayAudioProcessor::processChannel(void* context, int channel) noexcept
+{
+    juce::ScopedNoDenormals noDenormals; // workers don't inherit the audio thread's FTZ / DAZ flags
+    auto& self = *static_cast<DelayAudioProcessor*>(context);
+    const auto& job = self.channelJob;
+    const auto& delayLine = channel == 0 ? self.delayLineL : self.delayLineR;
+    auto& lowCutFilter = self.lowCutFilters[size_t(channel)];
+    auto& highCutFilter = self.highCutFilters[size_t(channel)];
+    float* wet = job.wet[channel];
+    float* filtered = job.filtered[channel];
+
+    if (job.constantDelay) {
+        delayLine.readBlock(job.delays[0], wet, job.numSamples);
+    } else {
+        delayLine.readBlock(job.delays, wet, job.numSamples);
+    }
+
+    // feedback source: the colored wet signal, or (Color on the wet output only) a
+    // clean read at the full delay, staged in the filtered block and filtered in place
+    const float* loop = wet;
+    if (self.activeColor > 0) {
+        self.convolvers[size_t(channel)].process(wet, job.numSamples);
+        if (!self.colorInLoop) {
+            if (job.constantLoopDelay) {
+                delayLine.readBlock(job.loopDelays[0], filtered, job.numSamples);
+            } else {
+                delayLine.readBlock(job.loopDelays, filtered, job.numSamples);
+            }
+            loop = filtered;
+        }
+    }
 
-    // update measurement objects with observed peaks
-    levelL.updateIfGreater(maxL);
-    levelR.updateIfGreater(maxR);
+    for (int i = 0; i < job.numSamples; ++i) {
+        float x = loop[i] * job.feedback[i];
+        x = lowCutFilter.processSample(x);
+        filtered[i] = highCutFilter.processSample(x);
+    }
 }
 
 //==============================================================================
@@ -285,18 +756,44 @@ juce::AudioProcessorEditor* DelayAudioProcessor::createEditor()
 }
 
 //==============================================================================
+// State format: a small header followed by the APVTS ValueTree in JUCE's compact binary
+// encoding (ValueTree::writeToStream). Much cheaper to build and parse than XML, which
+// matters when a session saves / loads hundreds of instances.
+//   int32 stateMagic | int32 stateVersion | ValueTree binary
+// Sessions saved by older versions (copyXmlToBinary) are still read.
+static constexpr int stateMagic = 0x594c4544;  // "DELY" (little-endian), distinct from JUCE's XML magic
+static constexpr int stateVersion = 1;         // bump when the layout of the state changes
+
 void DelayAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
 {
-    // serialize APVTS state to XML and copy into destData for host preset storage
-    copyXmlToBinary(*apvts.copyState().createXml(), destData);
+    juce::MemoryOutputStream stream(destData, false);
+    stream.writeInt(stateMagic);
+    stream.writeInt(stateVersion);
+    apvts.copyState().writeToStream(stream);
 }
 
 void DelayAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
 {
-    // restore APVTS state from binary XML provided by host
+    juce::MemoryInputStream stream(data, size_t(sizeInBytes), false);
+
+    if (sizeInBytes >= 8 && stream.readInt() == stateMagic) {
+        int version = stream.readInt();
+        if (version > stateVersion) {
+            return; // written by a newer version of the plug-in: don't guess
+        }
+        auto state = juce::ValueTree::readFromStream(stream);
+        if (state.isValid() && state.hasType(apvts.state.getType())) {
+            apvts.replaceState(state);
+            restoreExtraState();
+        }
+        return;
+    }
+
+    // legacy format: restore APVTS state from binary XML provided by host
     std::unique_ptr<juce::XmlElement> xml(getXmlFromBinary(data, sizeInBytes));
     if (xml.get() != nullptr && xml->hasTagName(apvts.state.getType())) {
         apvts.replaceState(juce::ValueTree::fromXml(*xml));
+        restoreExtraState();
     }
 }
 
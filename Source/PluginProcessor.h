@@ -8,7 +8,9 @@
  
     This file contains the basic framework code for a JUCE plugin processor.
  
-    Note: No MIDI functionality was implemented in this plug-in
+    Note: MIDI input is only used by the resonator mode (note on / off play the
+    ResonatorBank voices). It needs "Plugin MIDI Input" enabled in the Projucer
+    project settings (JucePlugin_WantsMidiInput), so hosts route MIDI to the effect.
 
   ==============================================================================
 */
@@ -17,9 +19,16 @@
 
 #include <JuceHeader.h>
 #include "Parameters.h"  // parameter helpers + smoothing
+#include "PresetBank.h"  // memory-mapped factory + user presets
 #include "Tempo.h"       // tempo helper (reads host BPM / converts note lengths)
 #include "DelayLine.h"   // circular delay buffer abstraction
+#include "Core/TptFilter.h" // state variable filter for the feedback tone controls
 #include "Measurement.h" // simple peak/level measurement utility
+#include "EnvelopeFifo.h" // decimated wet-signal envelope for the echo visualizer
+#include "SpectrumAnalyzer.h" // input vs. feedback-path spectrum (background thread)
+#include "ChannelWorkerPool.h" // optional parallel channel processing
+#include "ResonatorBank.h" // MIDI-driven Karplus-Strong voices
+#include "PartitionedConvolver.h" // echo color (tape / spring impulse in the loop)
 
 //==============================================================================
 // Main audio processor for the delay plugin.
@@ -67,6 +76,27 @@ public:
     const juce::String getProgramName (int index) override;
     void changeProgramName (int index, const juce::String& newName) override;
 
+    // Store the current parameter values as a user preset (message thread).
+    // Returns the preset's program index, or -1 if it couldn't be saved.
+    int saveUserPreset(const juce::String& name);
+
+    // Store the current parameter values in morph slot A or B (message thread).
+    // The slots are saved with the plug-in state.
+    void storeMorphSlot(int slot);
+
+    // Delay buffer memory of the whole session (every instance shares one BufferPool)
+    BufferPool::Stats getMemoryStats() const;
+
+    // Optional mode: process the two delay channels on separate cores when the block is
+    // long enough (see ChannelWorkerPool). Saved with the state; the worker thread is
+    // started / stopped at the next prepareToPlay.
+    void setParallelChannels(bool enabled);
+    bool getParallelChannels() const noexcept { return parallelChannels.load(); }
+
+    // The worker pool missed its latency budget and the audio thread went back to
+    // single-threaded processing (until the next prepareToPlay)
+    bool isParallelOverBudget() const noexcept { return workerPool.isOverBudget(); }
+
 
     void getStateInformation (juce::MemoryBlock& destData) override; // save plugin state
     void setStateInformation (const void* data, int sizeInBytes) override; // restore plugin state
@@ -80,18 +110,126 @@ public:
 
     Measurement levelL, levelR; // simple level peak trackers for left/right
 
+    // Echo visualizer feed: wet-signal envelope plus the delay time (ms) and feedback
+    // (-1..1) in effect at the end of the last block. The UI never reads the DelayLines.
+    EnvelopeFifo wetEnvelope;
+    std::atomic<float> currentDelayTime { 0.0f };
+    std::atomic<float> currentFeedback { 0.0f };
+
+    SpectrumAnalyzer analyzer; // analyzer overlay feed: dry input vs. feedback path
+
+    // Set by the editor while its UI is on screen. When false, processBlock skips the
+    // UI-only work above (meter peaks, echo envelope, analyzer feed).
+    std::atomic<bool> uiVisible { false };
+
     
     //=============================================================================
 private:
     
+    juce::SharedResourcePointer<BufferPool> bufferPool; // shared with the DelayLines, for stats
+
+    // Delay buffers are reserved for this rate, whatever the current one is
+    static constexpr double maxExpectedSampleRate = 192000.0;
     DelayLine delayLineL, delayLineR; // per-channel delay buffers
 
     float feedbackL = 0.0f; // current feedback sample for left
     float feedbackR = 0.0f; // current feedback sample for right
 
-    // StateVariable filters used in the feedback path for tone control
-    juce::dsp::StateVariableTPTFilter<float> lowCutFilter;
-    juce::dsp::StateVariableTPTFilter<float> highCutFilter;
+    // StateVariable filters (Core/TptFilter.h) used in the feedback path for tone control, one object per
+    // channel so the channels can run on different threads without sharing state
+    std::array<TptFilter, 2> lowCutFilters;
+    std::array<TptFilter, 2> highCutFilters;
+
+    void setFilterCutoffs(float lowCut, float highCut) noexcept; // both channels, if changed
+
+    // Per-sample control values for the current block, computed once up front from the
+    // smoothers, so both processing paths (and all channels) see the same ramps.
+    // delayRamp is the read delay (shortened by the Color read-ahead), loopDelayRamp the
+    // full delay (feedback read when Color sits on the wet output only).
+    enum Ramp { delayRamp, feedbackRamp, panLRamp, panRRamp, mixRamp, gainRamp,
+                lowCutRamp, highCutRamp, loopDelayRamp, numRamps };
+    juce::AudioBuffer<float> ramps;
+    juce::AudioBuffer<float> wetBlock;      // delayed signal per channel (0 = L, 1 = R)
+    juce::AudioBuffer<float> feedbackBlock; // filtered feedback per channel
+    juce::AudioBuffer<float> writeBlock;    // block engine: signal written into each line
+
+    template <int FixedSize>
+    void computeRamps(int numSamples, float syncedTime, float sampleRate) noexcept;
+
+    // Internal block size: processBlock runs the engine in chunks of this many samples
+    static constexpr int subBlockSize = 64;
+
+    // What processBlock's chunks share: I/O pointers, UI feed and the block's settings
+    struct BlockState
+    {
+        const float* inputDataL = nullptr;
+        const float* inputDataR = nullptr;
+        float* outputDataL = nullptr;
+        float* outputDataR = nullptr;
+        float syncedTime = 0.0f;       // tempo-synced delay (ms)
+        float sampleRate = 44100.0f;
+        float delayTime = 0.0f;        // last delay time used (ms), for the echo visualizer
+        bool parallel = false;         // parallel channel mode active
+        bool uiActive = false;         // feed meters / visualizers
+        float maxL = 0.0f;             // peak trackers for meters
+        float maxR = 0.0f;
+        int analyzerSamples = 0;       // analyzer staging (see analyzerScratch)
+        float* analyzerInput = nullptr;
+        float* analyzerFeedback = nullptr;
+        const juce::MidiBuffer* midi = nullptr; // notes for the resonator
+        bool resonator = false;        // resonator mode on
+    };
+
+    // FixedSize = subBlockSize for full chunks (compile-time trip counts), 0 for the rest
+    template <int FixedSize>
+    void processChunk(BlockState& state, int offset, int numSamples) noexcept;
+
+    // Sample-by-sample engine: only needed when the delay is shorter than the block,
+    // since then samples written in this block are read back within it.
+    void processPerSample(const float* inputDataL, const float* inputDataR, int numSamples) noexcept;
+
+    // Block engine (delay >= block length + 1), the default: read + filter each channel
+    // over the whole block (independent, optionally in parallel), then write the delay
+    // lines. constantDelay = the delay ramp is flat, so the reads can use the fast path.
+    void processBlockPass(const float* inputDataL, const float* inputDataR, int numSamples,
+                          bool parallel, bool constantDelay) noexcept;
+
+    // Per-channel work of processBlockPass; raw pointers are set up before the tasks run
+    struct ChannelJob
+    {
+        const float* delays = nullptr;
+        const float* loopDelays = nullptr;
+        const float* feedback = nullptr;
+        int numSamples = 0;
+        bool constantDelay = false;
+        bool constantLoopDelay = false;
+        float* wet[2] = {};
+        float* filtered[2] = {};
+    };
+    ChannelJob channelJob;
+    static void processChannel(void* context, int channel) noexcept;
+
+    // Color stage: the wet signal of each channel goes through a partitioned convolution
+    // right after the delay read. In the loop (default) both the output and the feedback
+    // hear it, so every repeat picks up a little more tape / spring, as in the real units.
+    // On the wet output only, the feedback comes from a second read at the full delay and
+    // stays clean. Either way the output read is shortened by the convolver's latency
+    // (Parameters::readAhead, ramped), so the echoes stay on time.
+    std::array<PartitionedConvolver, 2> convolvers;
+    int activeColor = 0;                     // Parameters::color in use (0 = clean)
+    bool colorInLoop = true;                 // Parameters::colorInLoop for this block
+
+    // Resonator mode: MIDI notes play Karplus-Strong voices that ring with the input;
+    // their sum is added to the wet signal of both channels
+    ResonatorBank resonator;
+    juce::AudioBuffer<float> resonatorBlock; // excitation in, resonator output out
+    bool resonatorActive = false;            // resonator mode in the previous block
+    void processResonator(BlockState& state, int offset, int numSamples) noexcept;
+
+    std::atomic<bool> parallelChannels { false };
+    ChannelWorkerPool workerPool;
+    static constexpr double parallelBudget = 0.05; // longest barrier wait, as a fraction of the block's duration
+    static constexpr double parallelIdleBlocks = 4.0; // block periods without a job before the worker slows down
 
     // cache last cutoff values to avoid redundant calls to setCutoffFrequency()
     float lastLowCut = -1.0f;
@@ -99,6 +237,15 @@ private:
 
     Tempo tempo; // tempo helper used for tempo-synced delay times
 
+    // Presets are the host's "programs". One bank is shared by all instances.
+    juce::SharedResourcePointer<PresetBank> presetBank;
+    std::atomic<int> currentProgram { 0 };
+
+    void restoreExtraState(); // reload morph slots + parallel mode from apvts.state after a state change
+
+    // per-block scratch for the analyzer: ch 0 = dry mono input, ch 1 = feedback path
+    juce::AudioBuffer<float> analyzerScratch;
+
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (DelayAudioProcessor)
 };
@@ -0,0 +1,350 @@
+/*
+  ==============================================================================
+    PresetBank.cpp
+    Created: 13 Apr 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the memory-mapped preset bank. On first use the bank file is
+    mapped; if it doesn't exist it is created from the factory presets below.
+    Saving a user preset appends it (or overwrites it in place), writes a new
+    file next to the old one and swaps it in.
+  ==============================================================================
+*/
+
+#include "PresetBank.h"
+
+#include <numeric>     // std::iota
+
+// Factory presets (plain values in Parameters::SnapshotIndex order):
+// gain dB, delay ms, mix %, feedback %, stereo %, low cut Hz, high cut Hz, sync 0/1, note index
+namespace
+{
+    struct FactoryPreset
+    {
+        const char* name;
+        std::array<float, Parameters::numSnapshotValues> values;
+    };
+
+    const FactoryPreset factoryPresets[] =
+    {
+        { "Init",              {  0.0f,  100.0f, 100.0f,   0.0f,    0.0f,   20.0f, 20000.0f, 0.0f,  9.0f } },
+        { "Slapback",          {  0.0f,   90.0f,  60.0f,  10.0f,    0.0f,   80.0f,  9000.0f, 0.0f,  9.0f } },
+        { "Quarter Note Sync", {  0.0f,  500.0f,  50.0f,  40.0f,    0.0f,  120.0f,  8000.0f, 1.0f,  9.0f } },
+        { "Dotted Eighth",     { -1.0f,  375.0f,  45.0f,  45.0f,   30.0f,  150.0f,  7000.0f, 1.0f,  8.0f } },
+        { "Ping Pong",         { -2.0f,  300.0f,  60.0f,  55.0f,  100.0f,  100.0f, 10000.0f, 0.0f,  9.0f } },
+        { "Wide Stereo",       { -1.0f,  250.0f,  40.0f,  35.0f,  -80.0f,   60.0f, 12000.0f, 0.0f,  9.0f } },
+        { "Tape Echo",         { -1.0f,  320.0f,  55.0f,  60.0f,   20.0f,  200.0f,  3500.0f, 0.0f,  9.0f } },
+        { "Dub Space",         { -3.0f,  650.0f,  70.0f,  80.0f,   50.0f,  300.0f,  2500.0f, 0.0f,  9.0f } },
+        { "Telephone Echo",    { -2.0f,  220.0f,  60.0f,  50.0f,    0.0f,  800.0f,  2500.0f, 0.0f,  9.0f } },
+        { "Infinite Wash",     { -6.0f, 1200.0f,  80.0f,  95.0f,   60.0f,   80.0f,  6000.0f, 0.0f,  9.0f } },
+        { "Negative Feedback", {  0.0f,  180.0f,  50.0f, -60.0f,    0.0f,   40.0f, 12000.0f, 0.0f,  9.0f } },
+        { "Comb Flutter",      {  0.0f,    8.0f,  50.0f,  70.0f,    0.0f,   20.0f, 20000.0f, 0.0f,  9.0f } },
+        { "Whole Note Swell",  { -3.0f, 2000.0f,  60.0f,  50.0f,   40.0f,  100.0f,  9000.0f, 1.0f, 15.0f } },
+    };
+}
+
+juce::File PresetBank::getBankFile()
+{
+    return juce::File::getSpecialLocation(juce::File::userApplicationDataDirectory)
+        .getChildFile(JucePlugin_Manufacturer)
+        .getChildFile(JucePlugin_Name)
+        .getChildFile("Presets.bank");
+}
+
+int PresetBank::getNumPresets()
+{
+    const juce::ScopedLock sl(lock);
+    ensureOpen();
+    return numPresets;
+}
+
+juce::String PresetBank::getName(int index)
+{
+    const juce::ScopedLock sl(lock);
+    ensureOpen();
+    if (auto* record = getRecord(index)) {
+        return juce::String::fromUTF8(record->name, int(strnlen(record->name, nameLength)));
+    }
+    return {};
+}
+
+bool PresetBank::isFactoryPreset(int index)
+{
+    const juce::ScopedLock sl(lock);
+    ensureOpen();
+    auto* record = getRecord(index);
+    return record != nullptr && (record->flags & factory) != 0;
+}
+
+bool PresetBank::getSnapshot(int index, Parameters::Snapshot& snapshot)
+{
+    const juce::ScopedLock sl(lock);
+    ensureOpen();
+    if (auto* record = getRecord(index)) {
+        std::copy(std::begin(record->values), std::end(record->values), snapshot.values.begin());
+        return true;
+    }
+    return false;
+}
+
+int PresetBank::findPreset(const juce::String& name)
+{
+    const juce::ScopedLock sl(lock);
+    ensureOpen();
+
+    auto key = makeRecord(name, 0, {});
+    int position = lowerBound(key, nameLength);
+    if (position < numPresets) {
+        int index = byName[size_t(position)];
+        if (compareNames(records[index].name, key.name, nameLength) == 0) {
+            return index;
+        }
+    }
+    return -1;
+}
+
+std::vector<int> PresetBank::findPresetsStartingWith(const juce::String& prefix)
+{
+    const juce::ScopedLock sl(lock);
+    ensureOpen();
+
+    auto key = makeRecord(prefix, 0, {});
+    size_t length = strnlen(key.name, nameLength);
+
+    // names sharing the prefix are contiguous in the name index
+    std::vector<int> matches;
+    for (int position = lowerBound(key, length); position < numPresets; ++position) {
+        int index = byName[size_t(position)];
+        if (compareNames(records[index].name, key.name, length) != 0) {
+            break;
+        }
+        matches.push_back(index);
+    }
+    return matches;
+}
+
+// First position in byName whose name isn't less than key's (first length bytes)
+int PresetBank::lowerBound(const Record& key, size_t length) const
+{
+    auto it = std::lower_bound(byName.begin(), byName.end(), key, [this, length](int index, const Record& k)
+                               { return compareNames(records[index].name, k.name, length) < 0; });
+    return int(it - byName.begin());
+}
+
+int PresetBank::saveUserPreset(const juce::String& name, const Parameters::Snapshot& snapshot)
+{
+    const juce::ScopedLock sl(lock);
+    ensureOpen();
+    if (!writable) {
+        return -1; // the unreadable bank is still in place: don't replace it
+    }
+
+    auto record = makeRecord(name, 0, snapshot);
+
+    // existing indices never change: overwrite in place or append
+    std::vector<Record> all(records, records + numPresets);
+    int index = findPreset(name);
+    if (index >= 0) {
+        if ((all[size_t(index)].flags & factory) != 0) {
+            return -1; // factory presets are read-only
+        }
+        all[size_t(index)] = record;
+    } else {
+        index = int(all.size());
+        all.push_back(record);
+    }
+
+    if (!writeBank(all)) {
+        return -1;
+    }
+    return index;
+}
+
+void PresetBank::ensureOpen()
+{
+    if (opened) {
+        return;
+    }
+    opened = true;
+
+    auto file = getBankFile();
+    if (!file.existsAsFile()) {
+        writeBank(createFactoryRecords()); // first run: start from the factory set
+        return;
+    }
+    if (mapFile() || migrateBank(file)) {
+        return;
+    }
+
+    // Unknown format, truncated, or from a newer version: keep it for the user (or a
+    // later version) as .bak and start again from the factory set.
+    auto backup = file.getSiblingFile(file.getFileName() + ".bak").getNonexistentSibling();
+    if (file.moveFileTo(backup)) {
+        writeBank(createFactoryRecords());
+    } else {
+        writable = false;                  // couldn't move it: run without presets, don't overwrite
+    }
+}
+
+// A bank written before snapshot values were appended has shorter records. Copy what
+// is there, fill the rest with the defaults and rewrite it in the current layout
+// (the original is kept as .bak).
+bool PresetBank::migrateBank(const juce::File& file)
+{
+    juce::MemoryBlock data;
+    if (!file.loadFileAsData(data) || data.getSize() < sizeof(Header)) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, data.getData(), sizeof(Header));
+    size_t numValues = header.numValues;
+    size_t recordSize = nameLength + sizeof(juce::uint32) + numValues * sizeof(float);
+    if (std::memcmp(header.magic, "DPRB", 4) != 0
+        || header.version != fileVersion
+        || numValues == 0 || numValues >= size_t(Parameters::numSnapshotValues)
+        || data.getSize() < sizeof(Header) + size_t(header.numPresets) * recordSize) {
+        return false;
+    }
+
+    const auto defaults = Parameters::getDefaults();
+    std::vector<Record> all(header.numPresets);
+    auto* source = static_cast<const char*>(data.getData()) + sizeof(Header);
+    for (auto& record : all) {
+        std::memcpy(record.name, source, nameLength);
+        record.name[nameLength - 1] = 0;
+        std::memcpy(&record.flags, source + nameLength, sizeof(juce::uint32));
+        std::copy(defaults.values.begin(), defaults.values.end(), record.values);
+        std::memcpy(record.values, source + nameLength + sizeof(juce::uint32), numValues * sizeof(float));
+        source += recordSize;
+    }
+
+    auto backup = file.getSiblingFile(file.getFileName() + ".bak").getNonexistentSibling();
+    return file.copyFileTo(backup) && writeBank(all);
+}
+
+bool PresetBank::mapFile()
+{
+    records = nullptr;
+    numPresets = 0;
+    byName.clear();
+    mappedFile.reset();
+
+    auto file = getBankFile();
+    if (!file.existsAsFile()) {
+        return false;
+    }
+
+    auto mapping = std::make_unique<juce::MemoryMappedFile>(file, juce::MemoryMappedFile::readOnly);
+    auto* data = static_cast<const char*>(mapping->getData());
+    size_t size = mapping->getSize();
+    if (data == nullptr || size < sizeof(Header)) {
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, data, sizeof(Header));
+    if (std::memcmp(header.magic, "DPRB", 4) != 0
+        || header.version != fileVersion
+        || header.numValues != juce::uint32(Parameters::numSnapshotValues)
+        || size < sizeof(Header) + size_t(header.numPresets) * sizeof(Record)) {
+        return false;
+    }
+
+    mappedFile = std::move(mapping);
+    records = reinterpret_cast<const Record*>(data + sizeof(Header));
+    numPresets = int(header.numPresets);
+
+    byName.resize(size_t(numPresets));
+    std::iota(byName.begin(), byName.end(), 0);
+    std::stable_sort(byName.begin(), byName.end(), [this](int a, int b)
+                     { return compareNames(records[a].name, records[b].name, nameLength) < 0; });
+    return true;
+}
+
+const PresetBank::Record* PresetBank::getRecord(int index) const noexcept
+{
+    if (index < 0 || index >= numPresets) {
+        return nullptr;
+    }
+    return records + index;
+}
+
+bool PresetBank::writeBank(const std::vector<Record>& all)
+{
+    Header header {};
+    std::memcpy(header.magic, "DPRB", 4);
+    header.version = fileVersion;
+    header.numPresets = juce::uint32(all.size());
+    header.numValues = juce::uint32(Parameters::numSnapshotValues);
+
+    auto file = getBankFile();
+    file.getParentDirectory().createDirectory();
+
+    // unmap before replacing the file (required on Windows)
+    mappedFile.reset();
+    records = nullptr;
+    numPresets = 0;
+    byName.clear();
+
+    juce::TemporaryFile temp(file);
+    {
+        juce::FileOutputStream out(temp.getFile());
+        if (!out.openedOk()) {
+            return mapFile();
+        }
+        out.write(&header, sizeof(Header));
+        out.write(all.data(), all.size() * sizeof(Record));
+        out.flush();
+        if (out.getStatus().failed()) {
+            return mapFile();
+        }
+    }
+
+    if (!temp.overwriteTargetFileWithTemporary()) {
+        return mapFile();
+    }
+    return mapFile();
+}
+
+PresetBank::Record PresetBank::makeRecord(const juce::String& name, juce::uint32 flags,
+                                          const Parameters::Snapshot& snapshot)
+{
+    Record record {};
+    name.copyToUTF8(record.name, nameLength); // truncates, always 0-terminated
+    record.flags = flags;
+    std::copy(snapshot.values.begin(), snapshot.values.end(), record.values);
+    return record;
+}
+
+std::vector<PresetBank::Record> PresetBank::createFactoryRecords()
+{
+    std::vector<Record> all;
+    for (const auto& preset : factoryPresets) {
+        Parameters::Snapshot snapshot;
+        snapshot.values = preset.values;
+        all.push_back(makeRecord(preset.name, factory, snapshot));
+    }
+    return all;
+}
+
+// Case-insensitive (ASCII) comparison of at most length bytes of two 0-terminated names.
+int PresetBank::compareNames(const char* a, const char* b, size_t length) noexcept
+{
+    for (size_t i = 0; i < length; ++i) {
+        int ca = std::tolower(static_cast<unsigned char>(a[i]));
+        int cb = std::tolower(static_cast<unsigned char>(b[i]));
+        if (ca != cb) {
+            return ca - cb;
+        }
+        if (ca == 0) {
+            break;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+/*
+  ==============================================================================
+    PresetBank.h
+    Created: 13 Apr 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Factory + user presets in one file, memory-mapped read-only.
+    The file is a header followed by fixed-size records: the factory
+    presets first, then user presets in the order they were saved. A
+    preset keeps its index (program number) for good, so saving in one
+    instance never moves the current program of another. Then
+     - preset i is a pointer offset (no parsing, no per-preset allocation),
+     - name lookup and prefix search are binary searches over an index
+       sorted by name (case-insensitive), rebuilt whenever the file is mapped,
+     - thousands of presets cost one mapping, paged in on demand.
+    Layout (native byte order, all fields 4-byte aligned):
+        Header { char magic[4] "DPRB"; uint32 version; uint32 numPresets; uint32 numValues; }
+        Record { char name[32]; uint32 flags; float values[numValues]; } * numPresets
+    One bank is shared by every plug-in instance in the process. A file with
+    fewer values per record (written before a snapshot value was appended)
+    is migrated by filling in the defaults; a file that can't be read is
+    kept as Presets.bank.bak, never overwritten.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "Parameters.h"   // Parameters::Snapshot
+
+class PresetBank
+{
+public:
+    static constexpr int nameLength = 32;   // bytes per name, including the terminating 0
+
+    PresetBank() = default;                 // the file is opened on first use, not here
+
+    int getNumPresets();
+    juce::String getName(int index);
+    bool isFactoryPreset(int index);
+    bool getSnapshot(int index, Parameters::Snapshot& snapshot);
+
+    // Index of the preset with exactly this name (case-insensitive), or -1
+    int findPreset(const juce::String& name);
+
+    // Indices of the presets whose names start with prefix (case-insensitive), in name order
+    std::vector<int> findPresetsStartingWith(const juce::String& prefix);
+
+    // Add a user preset at the end, or overwrite the user preset of that name in place.
+    // Rewrites the file and remaps it, so only call this from the message thread.
+    // Returns the preset's index, or -1 on failure.
+    int saveUserPreset(const juce::String& name, const Parameters::Snapshot& snapshot);
+
+    static juce::File getBankFile();
+
+private:
+    struct Header
+    {
+        char magic[4];
+        juce::uint32 version;
+        juce::uint32 numPresets;
+        juce::uint32 numValues;
+    };
+
+    struct Record
+    {
+        char name[nameLength];
+        juce::uint32 flags;                                  // Flags below
+        float values[Parameters::numSnapshotValues];
+    };
+
+    enum Flags : juce::uint32 { factory = 1 };
+
+    static constexpr juce::uint32 fileVersion = 1;
+
+    void ensureOpen();                                       // map the file, create / migrate it if needed
+    bool mapFile();                                          // (re)map; false if missing / invalid
+    bool migrateBank(const juce::File& file);                // older numValues -> current layout
+    const Record* getRecord(int index) const noexcept;
+    bool writeBank(const std::vector<Record>& records);      // write to temp file, replace
+    int lowerBound(const Record& key, size_t length) const;  // position in byName
+
+    static Record makeRecord(const juce::String& name, juce::uint32 flags, const Parameters::Snapshot&);
+    static std::vector<Record> createFactoryRecords();
+    static int compareNames(const char* a, const char* b, size_t length) noexcept;
+
+    juce::CriticalSection lock;          // guards the mapping (never taken on the audio thread)
+    std::unique_ptr<juce::MemoryMappedFile> mappedFile;
+    const Record* records = nullptr;     // points into the mapping
+    int numPresets = 0;
+    std::vector<int> byName;             // record indices sorted by name
+    bool opened = false;
+    bool writable = true;                // false while an unreadable file couldn't be moved aside
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PresetBank)
+};
@@ -0,0 +1,105 @@
+/*
+  ==============================================================================
+    RefreshScheduler.cpp
+    Created: 2 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the shared UI frame clock. All bookkeeping happens on the
+    message thread, so no locking is needed.
+  ==============================================================================
+*/
+
+#include "RefreshScheduler.h"
+
+RefreshScheduler::~RefreshScheduler()
+{
+    jassert(attachments.isEmpty()); // every Attachment holds a reference to us
+    stopTimer();
+}
+
+RefreshScheduler::Attachment::Attachment(juce::Component& component_, std::function<void()> callback_,
+                                         std::function<void(bool)> showingChanged_)
+    : component(component_), callback(std::move(callback_)), showingChanged(std::move(showingChanged_))
+{
+    scheduler->add(this);
+}
+
+RefreshScheduler::Attachment::~Attachment()
+{
+    scheduler->remove(this);
+}
+
+void RefreshScheduler::add(Attachment* attachment)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    attachments.addIfNotAlreadyThere(attachment);
+
+    if (!isTimerRunning()) {
+        startTimerHz(refreshRate); // first client: start the shared clock
+    }
+}
+
+void RefreshScheduler::remove(Attachment* attachment)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+    attachments.removeFirstMatchingValue(attachment);
+
+    if (attachments.isEmpty()) {
+        stopTimer(); // nothing left to animate: don't wake up the message thread
+    }
+}
+
+void RefreshScheduler::timerCallback()
+{
+    // A callback may delete widgets (and so their attachments), its own included, or
+    // add new ones. Walk a copy of this frame's list and skip every entry that has been
+    // removed in the meantime, before each call. The local pointer keeps the scheduler
+    // alive if the last attachment goes away inside a callback.
+    juce::SharedResourcePointer<RefreshScheduler> keepAlive;
+    const auto frame = attachments;
+
+    for (int i = frame.size(); --i >= 0;) {
+        auto* attachment = frame.getUnchecked(i);
+        if (!attachments.contains(attachment)) {
+            continue;
+        }
+
+        bool showing = isOnScreen(attachment->component);
+
+        if (showing != attachment->wasShowing) {
+            attachment->wasShowing = showing;
+            if (attachment->showingChanged) {
+                attachment->showingChanged(showing); // e.g. suspend / resume background work
+            }
+        }
+
+        if (showing && attachments.contains(attachment)) {
+            attachment->callback();
+        }
+    }
+}
+
+// isShowing() is false when the component or any parent is hidden, or when the
+// window it lives in is minimised. On top of that, a window dragged completely
+// off the desktop (or parked there by a tiling host) doesn't count as visible.
+// Note: JUCE has no portable way to ask whether other windows fully cover ours,
+// so a covered but on-screen window is still treated as visible.
+bool RefreshScheduler::isOnScreen(juce::Component& component)
+{
+    if (!component.isShowing()) {
+        return false;
+    }
+
+    auto* peer = component.getPeer();
+    if (peer == nullptr || peer->isMinimised()) {
+        return false;
+    }
+
+    auto desktopArea = juce::Desktop::getInstance().getDisplays().getTotalBounds(false);
+    return desktopArea.intersects(component.getScreenBounds());
+}
@@ -0,0 +1,72 @@
+/*
+  ==============================================================================
+    RefreshScheduler.h
+    Created: 2 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    One process-wide timer that drives every animated widget (meters, LEDs,
+    visualizers) of every open editor in a single pass per frame, instead of
+    each widget running its own juce::Timer out of phase with the others.
+    Widgets that can't be seen (hidden, minimised window, window moved
+    entirely off-screen) are skipped, and can be told when that changes so
+    they can suspend background work too.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+// Shared frame clock for the UI. Never used directly: create an Attachment and
+// the scheduler (a SharedResourcePointer) starts when the first one exists and
+// stops when the last one goes away.
+class RefreshScheduler : private juce::Timer
+{
+public:
+    static constexpr int refreshRate = 60; // UI frame rate in Hz shared by all widgets
+
+    RefreshScheduler() = default;          // public so SharedResourcePointer can create it
+    ~RefreshScheduler() override;
+
+    // Registers a per-frame callback for a component (same idea as juce::VBlankAttachment).
+    // The callback runs on the message thread only while the component is on screen.
+    // The optional showingChanged callback is called (on a frame tick) whenever that
+    // on-screen state flips; it is never called from the destructor.
+    class Attachment
+    {
+    public:
+        Attachment(juce::Component& component, std::function<void()> callback,
+                   std::function<void(bool)> showingChanged = {});
+        ~Attachment();
+
+    private:
+        friend class RefreshScheduler;
+
+        juce::Component& component;                         // widget that owns this attachment
+        std::function<void()> callback;                      // per-frame update
+        std::function<void(bool)> showingChanged;            // optional on-screen state change
+        bool wasShowing = false;                             // on-screen state at the last frame
+        juce::SharedResourcePointer<RefreshScheduler> scheduler;
+
+        JUCE_DECLARE_NON_COPYABLE (Attachment)
+    };
+
+private:
+    void timerCallback() override; // one frame: update every visible attachment
+
+    // True if the component could be seen: it and all parents are visible, its window
+    // isn't minimised and it isn't entirely off-screen.
+    static bool isOnScreen(juce::Component& component);
+
+    void add(Attachment* attachment);
+    void remove(Attachment* attachment);
+
+    juce::Array<Attachment*> attachments; // message thread only
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RefreshScheduler)
+};
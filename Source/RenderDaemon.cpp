@@ -0,0 +1,103 @@
+/*
+  ==============================================================================
+    RenderDaemon.cpp
+    Created: 12 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Entry point of the headless render daemon (RenderService). Only compiled
+    when DELAY_RENDER_DAEMON=1, i.e. in a separate "Console Application"
+    target that builds the whole Source folder with the same JucePlugin_*
+    settings as the plug-in (DelayRenderDaemon in CMakeLists.txt); the
+    plug-in targets never see this main(). DelayTests also builds the
+    service (DELAY_UNIT_TESTS) and brings its own main().
+
+      DelayRenderDaemon [--socket=/tmp/delay-render.sock] [--pool=4]
+                        [--rate=48000] [--block=4096] [--slots=64]
+                        [--parallel]
+
+    --parallel lets every session split its two channels across two cores
+    (shorter turnaround per stem, more threads overall).
+
+    Runs until SIGINT / SIGTERM. The message loop runs on the main thread
+    because the processors' parameter trees use it (state changes and
+    prepareToPlay are handed to it); rendering happens on the session
+    threads.
+  ==============================================================================
+*/
+
+#if DELAY_RENDER_DAEMON && ! DELAY_UNIT_TESTS && ! JUCE_WINDOWS
+
+#include "RenderService.h"
+#include <csignal>
+#include <iostream>
+
+static std::atomic<bool> stopRequested { false };
+
+static void requestStop(int)
+{
+    stopRequested = true;                    // async-signal-safe; the timer below acts on it
+}
+
+// Ends the message loop once a signal came in
+class StopWatcher : private juce::Timer
+{
+public:
+    StopWatcher() { startTimer(100); }
+
+private:
+    void timerCallback() override
+    {
+        if (stopRequested) {
+            stopTimer();
+            juce::MessageManager::getInstance()->stopDispatchLoop();
+        }
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;   // message manager, no windows
+    juce::ArgumentList args(argc, argv);
+
+    RenderService::Options options;
+    if (args.containsOption("--socket")) {
+        options.socketPath = args.getValueForOption("--socket");
+    }
+    if (args.containsOption("--pool")) {
+        options.numWarmProcessors = juce::jlimit(0, 256, args.getValueForOption("--pool").getIntValue());
+    }
+    if (args.containsOption("--rate")) {
+        options.sampleRate = juce::jlimit(8000.0, 192000.0, args.getValueForOption("--rate").getDoubleValue());
+    }
+    if (args.containsOption("--block")) {
+        options.maxBlockSize = juce::jlimit(16, 65536, args.getValueForOption("--block").getIntValue());
+    }
+    if (args.containsOption("--slots")) {
+        options.maxSlots = juce::jlimit(1, 1024, args.getValueForOption("--slots").getIntValue());
+    }
+
+    options.parallelChannels = args.containsOption("--parallel");
+
+    RenderService service(options);
+    if (!service.start()) {
+        std::cerr << service.getLastError() << std::endl;
+        return 1;
+    }
+    std::cout << "listening on " << options.socketPath << std::endl;
+
+    std::signal(SIGINT, requestStop);
+    std::signal(SIGTERM, requestStop);
+
+    StopWatcher stopWatcher;
+    juce::MessageManager::getInstance()->runDispatchLoop();
+
+    service.stop();
+    return 0;
+}
+
+#endif
@@ -0,0 +1,83 @@
+/*
+  ==============================================================================
+    RenderProtocol.h
+    Created: 12 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Wire format of the render service (RenderService / RenderDaemon). Only
+    standard types, so render-farm clients can include this header without
+    JUCE. A session is:
+     1. connect to the daemon's Unix domain socket and send a hello Request
+        (slot = number of slots, numSamples = largest chunk, sampleRate;
+        optional payload = plug-in state). The Reply names a shared memory
+        object: shm_open + mmap it (read / write).
+     2. the shared memory is a ring of slots. Slot s holds planar stereo
+        audio: channel c starts at float (s * numChannels + c) * maxBlockSize.
+        Write a chunk into a free slot and send a process Request for it
+        (optional payload = new plug-in state, applied before the chunk).
+        The service processes the slot in place; its Reply means the slot
+        now holds the result. Requests are handled in order, so a client
+        can keep every slot in flight and reuse each one after its Reply.
+     3. reset clears the delay tails (next stem), setState changes the
+        parameters, goodbye ends the session.
+    All fields are in the host's byte order: the socket is local.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <cstdint>
+
+struct RenderProtocol
+{
+    static constexpr uint32_t magic = 0x52594c44;           // "DLYR"
+    static constexpr int numChannels = 2;                   // stereo in, stereo out
+    static constexpr uint32_t maxPayloadSize = 1 << 20;     // plug-in state blobs are a few KB
+
+    enum MessageType : uint32_t
+    {
+        hello = 1,      // open the session (once)
+        process,        // render slot in place
+        setState,       // payload = getStateInformation() blob
+        reset,          // clear delay lines / filters, keep parameters
+        goodbye         // end the session
+    };
+
+    enum Status : uint32_t
+    {
+        ok = 0,
+        badRequest,     // malformed, out of range, or before hello
+        noMemory,       // shared memory couldn't be created
+        shuttingDown    // the daemon is stopping; the request wasn't carried out
+    };
+
+    struct Request
+    {
+        uint32_t magic = RenderProtocol::magic;
+        uint32_t type = 0;
+        uint32_t slot = 0;          // hello: number of slots
+        uint32_t numSamples = 0;    // hello: largest chunk (maxBlockSize)
+        uint32_t payloadSize = 0;   // bytes following this header
+        uint32_t reserved = 0;
+        double sampleRate = 0.0;    // hello only
+    };
+
+    struct Reply
+    {
+        uint32_t magic = RenderProtocol::magic;
+        uint32_t status = ok;
+        uint32_t slot = 0;
+        uint32_t numSamples = 0;
+        uint32_t numSlots = 0;          // hello only
+        uint32_t maxBlockSize = 0;      // hello only
+        char sharedMemoryName[64] {};   // hello only, for shm_open
+    };
+
+    static_assert(sizeof(Request) == 32, "wire format");
+    static_assert(sizeof(Reply) == 88, "wire format");
+};
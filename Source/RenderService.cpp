@@ -0,0 +1,531 @@
+/*
+  ==============================================================================
+    RenderService.cpp
+    Created: 12 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the processor pool and the socket / shared memory sessions of
+    the render service (see RenderService.h, RenderProtocol.h).
+  ==============================================================================
+*/
+
+#include "RenderService.h"
+
+#if DELAY_RENDER_DAEMON && ! JUCE_WINDOWS
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+// Read / write exactly size bytes (the socket may deliver less per call).
+// false once the peer has closed the connection or on an error.
+static bool readFully(int socket, void* data, size_t size)
+{
+    auto* bytes = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = ::recv(socket, bytes, size, 0);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        bytes += n;
+        size -= size_t(n);
+    }
+    return true;
+}
+
+static bool writeFully(int socket, const void* data, size_t size)
+{
+   #ifdef MSG_NOSIGNAL
+    constexpr int flags = MSG_NOSIGNAL;    // a client that went away must not kill the daemon
+   #else
+    constexpr int flags = 0;               // macOS: SO_NOSIGPIPE is set on the socket instead
+   #endif
+
+    auto* bytes = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = ::send(socket, bytes, size, flags);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        bytes += n;
+        size -= size_t(n);
+    }
+    return true;
+}
+
+// Run function on the message thread and wait for it (directly, if this is the message
+// thread). The APVTS timer writes the parameter tree there, so setStateInformation and
+// prepareToPlay must not run on a session thread at the same time. Returns false without
+// running function if the calling thread is asked to exit first: RenderService::stop
+// waits for the sessions on the message thread, so they can't wait for it then.
+static bool callOnMessageThread(std::function<void()> function)
+{
+    auto* messageManager = juce::MessageManager::getInstanceWithoutCreating();
+    if (messageManager == nullptr) {
+        return false;
+    }
+    if (messageManager->isThisTheMessageThread()) {
+        function();
+        return true;
+    }
+
+    enum { pending, running, cancelled };
+    struct Call
+    {
+        std::function<void()> function;
+        std::atomic<int> state { pending };
+        juce::WaitableEvent done;
+    };
+    auto call = std::make_shared<Call>();
+    call->function = std::move(function);
+
+    bool posted = juce::MessageManager::callAsync([call]
+    {
+        int expected = pending;
+        if (call->state.compare_exchange_strong(expected, running)) {   // not given up on
+            call->function();
+        }
+        call->done.signal();
+    });
+    if (!posted) {
+        return false;
+    }
+
+    while (!call->done.wait(50)) {
+        int expected = pending;
+        if (juce::Thread::currentThreadShouldExit() && call->state.compare_exchange_strong(expected, cancelled)) {
+            return false;                    // never runs now; a running call is waited for
+        }
+    }
+    return true;
+}
+
+//==============================================================================
+ProcessorPool::ProcessorPool(int numWarm, double sampleRate, int maxBlockSize, bool parallel)
+    : parallelChannels(parallel)
+{
+    JUCE_ASSERT_MESSAGE_THREAD
+
+    DelayAudioProcessor fresh;
+    fresh.getStateInformation(defaultState);
+
+    for (int i = 0; i < numWarm; ++i) {
+        auto processor = std::make_unique<DelayAudioProcessor>();
+        prepare(*processor, sampleRate, maxBlockSize);
+        idle.push_back({ std::move(processor), false });
+    }
+}
+
+void ProcessorPool::prepare(DelayAudioProcessor& processor, double sampleRate, int maxBlockSize)
+{
+    processor.setNonRealtime(true);          // offline render: no real-time deadline
+    processor.setRateAndBufferSizeDetails(sampleRate, maxBlockSize);
+    processor.setParallelChannels(parallelChannels);   // daemon setting (a client state may have changed it)
+    processor.prepareToPlay(sampleRate, maxBlockSize);
+}
+
+// forget the session: default parameters, then prepareToPlay clears the delay lines
+// and filters and jumps the smoothers to the restored values
+void ProcessorPool::restoreDefaults(DelayAudioProcessor& processor, double sampleRate, int maxBlockSize)
+{
+    processor.setStateInformation(defaultState.getData(), int(defaultState.getSize()));
+    prepare(processor, sampleRate, maxBlockSize);
+}
+
+std::unique_ptr<DelayAudioProcessor> ProcessorPool::acquire(double sampleRate, int maxBlockSize)
+{
+    IdleProcessor entry;
+    {
+        const juce::ScopedLock sl(lock);
+
+        // one that is prepared for these settings already, else any idle one
+        auto it = std::find_if(idle.begin(), idle.end(), [&](const auto& p) {
+            return !p.needsReset && p.processor->getSampleRate() == sampleRate
+                && p.processor->getBlockSize() == maxBlockSize;
+        });
+        if (it == idle.end() && !idle.empty()) {
+            it = idle.end() - 1;
+        }
+        if (it != idle.end()) {
+            entry = std::move(*it);
+            idle.erase(it);
+        }
+    }
+
+    auto& processor = entry.processor;
+    bool ready = true;
+    if (processor == nullptr) {              // pool exhausted: grow it (kept warm after release)
+        ready = callOnMessageThread([&] {
+            processor = std::make_unique<DelayAudioProcessor>();
+            prepare(*processor, sampleRate, maxBlockSize);
+        });
+    } else if (entry.needsReset) {
+        ready = callOnMessageThread([&] { restoreDefaults(*processor, sampleRate, maxBlockSize); });
+    } else if (processor->getSampleRate() != sampleRate || processor->getBlockSize() != maxBlockSize) {
+        ready = callOnMessageThread([&] { prepare(*processor, sampleRate, maxBlockSize); });
+    }
+
+    if (!ready) {                            // stopping: back to the pool as it was
+        if (processor != nullptr) {
+            const juce::ScopedLock sl(lock);
+            idle.push_back(std::move(entry));
+        }
+        return nullptr;
+    }
+    return std::move(processor);
+}
+
+void ProcessorPool::release(std::unique_ptr<DelayAudioProcessor> processor)
+{
+    if (processor == nullptr) {
+        return;
+    }
+
+    bool reset = callOnMessageThread([&] {
+        restoreDefaults(*processor, processor->getSampleRate(), processor->getBlockSize());
+    });
+
+    const juce::ScopedLock sl(lock);
+    idle.push_back({ std::move(processor), !reset });
+}
+
+int ProcessorPool::getNumIdle() const
+{
+    const juce::ScopedLock sl(lock);
+    return int(idle.size());
+}
+
+//==============================================================================
+// One client connection: its processor, its shared memory ring and the thread that
+// answers its requests.
+class RenderService::Session : public juce::Thread
+{
+public:
+    Session(RenderService& owner, int clientSocket)
+        : juce::Thread("Delay render session"), service(owner), socket(clientSocket)
+    {
+    }
+
+    ~Session() override
+    {
+        shutdownSocket();
+        stopThread(4000);
+        ::close(socket);
+    }
+
+    // Unblock a pending read so run() returns (RenderService::stop)
+    void shutdownSocket()
+    {
+        ::shutdown(socket, SHUT_RDWR);
+    }
+
+    bool isFinished() const noexcept { return finished.load(); }
+
+    void run() override
+    {
+        RenderProtocol::Request request;
+        while (!threadShouldExit() && readFully(socket, &request, sizeof(request))) {
+            if (request.magic != RenderProtocol::magic || request.payloadSize > RenderProtocol::maxPayloadSize) {
+                break;                                   // not our protocol: drop the client
+            }
+
+            payload.setSize(request.payloadSize, false);
+            if (request.payloadSize > 0 && !readFully(socket, payload.getData(), request.payloadSize)) {
+                break;
+            }
+
+            RenderProtocol::Reply reply;
+            reply.slot = request.slot;
+            reply.numSamples = request.numSamples;
+            reply.status = handle(request, reply);
+
+            if (!writeFully(socket, &reply, sizeof(reply)) || request.type == RenderProtocol::goodbye) {
+                break;
+            }
+        }
+
+        service.pool->release(std::move(processor));
+        unmapRing();
+        finished = true;
+    }
+
+private:
+    RenderProtocol::Status handle(const RenderProtocol::Request& request, RenderProtocol::Reply& reply)
+    {
+        if (request.type == RenderProtocol::hello) {
+            return open(request, reply);
+        }
+        if (request.type == RenderProtocol::goodbye) {
+            return RenderProtocol::ok;
+        }
+        if (processor == nullptr) {
+            return RenderProtocol::badRequest;           // everything else needs hello first
+        }
+
+        switch (request.type) {
+            case RenderProtocol::process:
+                if (request.slot >= uint32_t(numSlots) || request.numSamples > uint32_t(maxBlockSize)) {
+                    return RenderProtocol::badRequest;
+                }
+                if (!applyState()) {
+                    return RenderProtocol::shuttingDown;
+                }
+                render(int(request.slot), int(request.numSamples));
+                return RenderProtocol::ok;
+
+            case RenderProtocol::setState:
+                return applyState() ? RenderProtocol::ok : RenderProtocol::shuttingDown;
+
+            case RenderProtocol::reset: {                // next stem: silence, same parameters
+                auto* p = processor.get();
+                bool done = callOnMessageThread([p] { p->prepareToPlay(p->getSampleRate(), p->getBlockSize()); });
+                return done ? RenderProtocol::ok : RenderProtocol::shuttingDown;
+            }
+
+            default:
+                return RenderProtocol::badRequest;
+        }
+    }
+
+    // hello: check the requested ring, take a warm processor, create the shared memory
+    RenderProtocol::Status open(const RenderProtocol::Request& request, RenderProtocol::Reply& reply)
+    {
+        const auto& options = service.options;
+        if (processor != nullptr
+            || request.slot < 1 || request.slot > uint32_t(options.maxSlots)
+            || request.numSamples < 1 || request.numSamples > uint32_t(options.maxBlockSize)
+            || !(request.sampleRate >= 8000.0 && request.sampleRate <= 192000.0)) {
+            return RenderProtocol::badRequest;
+        }
+
+        numSlots = int(request.slot);
+        maxBlockSize = int(request.numSamples);
+        if (!mapRing()) {
+            return RenderProtocol::noMemory;
+        }
+
+        processor = service.pool->acquire(request.sampleRate, maxBlockSize);
+        if (processor == nullptr || !applyState()) {
+            unmapRing();
+            return RenderProtocol::shuttingDown;
+        }
+
+        reply.numSlots = uint32_t(numSlots);
+        reply.maxBlockSize = uint32_t(maxBlockSize);
+        sharedMemoryName.copyToUTF8(reply.sharedMemoryName, sizeof(reply.sharedMemoryName));
+        return RenderProtocol::ok;
+    }
+
+    // Optional state blob sent with the request (getStateInformation format), applied on
+    // the message thread. false if the service is stopping.
+    bool applyState()
+    {
+        if (payload.getSize() == 0) {
+            return true;
+        }
+        return callOnMessageThread([this] {
+            processor->setStateInformation(payload.getData(), int(payload.getSize()));
+        });
+    }
+
+    // Process the slot in place: the AudioBuffer points into the shared memory
+    void render(int slot, int numSamples)
+    {
+        if (numSamples == 0) {
+            return;
+        }
+
+        float* channels[RenderProtocol::numChannels];
+        for (int c = 0; c < RenderProtocol::numChannels; ++c) {
+            channels[c] = ring + size_t(slot * RenderProtocol::numChannels + c) * size_t(maxBlockSize);
+        }
+        juce::AudioBuffer<float> buffer(channels, RenderProtocol::numChannels, numSamples);
+
+        midi.clear();
+        processor->processBlock(buffer, midi);
+    }
+
+    bool mapRing()
+    {
+        static std::atomic<int> counter { 0 };
+        sharedMemoryName = "/dlyr-" + juce::String(int(::getpid())) + "-" + juce::String(++counter);
+        ringBytes = size_t(numSlots) * RenderProtocol::numChannels * size_t(maxBlockSize) * sizeof(float);
+
+        int fd = ::shm_open(sharedMemoryName.toRawUTF8(), O_CREAT | O_EXCL | O_RDWR, 0600);
+        if (fd < 0) {
+            return false;
+        }
+
+        void* data = MAP_FAILED;
+        if (::ftruncate(fd, off_t(ringBytes)) == 0) {    // new pages read as zero
+            data = ::mmap(nullptr, ringBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        }
+        ::close(fd);                                     // the mapping keeps the object open
+
+        if (data == MAP_FAILED) {
+            ::shm_unlink(sharedMemoryName.toRawUTF8());
+            return false;
+        }
+        ring = static_cast<float*>(data);
+        return true;
+    }
+
+    // The client's mapping stays valid until it unmaps; unlinking only removes the name.
+    void unmapRing()
+    {
+        if (ring != nullptr) {
+            ::munmap(ring, ringBytes);
+            ::shm_unlink(sharedMemoryName.toRawUTF8());
+            ring = nullptr;
+        }
+    }
+
+    RenderService& service;
+    int socket;
+    std::atomic<bool> finished { false };
+
+    std::unique_ptr<DelayAudioProcessor> processor;   // from the pool, between hello and the end
+    juce::MemoryBlock payload;                        // state blob of the current request
+    juce::MidiBuffer midi;                            // always empty (no resonator notes)
+
+    juce::String sharedMemoryName;
+    float* ring = nullptr;                            // numSlots * numChannels * maxBlockSize floats
+    size_t ringBytes = 0;
+    int numSlots = 0;
+    int maxBlockSize = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Session)
+};
+
+//==============================================================================
+RenderService::RenderService(const Options& o)
+    : juce::Thread("Delay render service"), options(o)
+{
+}
+
+RenderService::~RenderService()
+{
+    stop();
+}
+
+bool RenderService::start()
+{
+    jassert(listenSocket < 0);
+
+    sockaddr_un address {};
+    address.sun_family = AF_UNIX;
+    if (options.socketPath.getNumBytesAsUTF8() >= sizeof(address.sun_path)) {
+        lastError = "socket path too long: " + options.socketPath;
+        return false;
+    }
+    options.socketPath.copyToUTF8(address.sun_path, sizeof(address.sun_path));
+
+    if (pool == nullptr) {
+        pool = std::make_unique<ProcessorPool>(options.numWarmProcessors, options.sampleRate, options.maxBlockSize,
+                                               options.parallelChannels);
+    }
+
+    listenSocket = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listenSocket < 0) {
+        lastError = "socket(): " + juce::String(std::strerror(errno));
+        return false;
+    }
+
+    ::unlink(address.sun_path);                  // stale socket of a previous run
+    if (::bind(listenSocket, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0
+        || ::chmod(address.sun_path, 0600) != 0  // same user only: the state blobs aren't validated
+        || ::listen(listenSocket, 16) != 0) {
+        lastError = "bind / listen on " + options.socketPath + ": " + juce::String(std::strerror(errno));
+        ::close(listenSocket);
+        listenSocket = -1;
+        return false;
+    }
+
+    startThread();
+    return true;
+}
+
+void RenderService::stop()
+{
+    if (listenSocket < 0) {
+        return;
+    }
+
+    signalThreadShouldExit();
+    stopThread(2000);                            // the accept loop polls every 200 ms
+
+    {
+        const juce::ScopedLock sl(sessionLock);
+        for (auto* session : sessions) {
+            session->shutdownSocket();
+        }
+        sessions.clear();                        // waits for each session to release its processor
+    }
+
+    ::close(listenSocket);
+    listenSocket = -1;
+    ::unlink(options.socketPath.toRawUTF8());
+}
+
+int RenderService::getNumSessions() const
+{
+    const juce::ScopedLock sl(sessionLock);
+    int count = 0;
+    for (auto* session : sessions) {
+        count += session->isFinished() ? 0 : 1;
+    }
+    return count;
+}
+
+void RenderService::run()
+{
+    while (!threadShouldExit()) {
+        pollfd request { listenSocket, POLLIN, 0 };
+        int ready = ::poll(&request, 1, 200);
+        reapFinishedSessions();
+        if (ready <= 0) {
+            continue;
+        }
+
+        int client = ::accept(listenSocket, nullptr, nullptr);
+        if (client < 0) {
+            continue;
+        }
+       #ifdef SO_NOSIGPIPE
+        int on = 1;
+        ::setsockopt(client, SOL_SOCKET, SO_NOSIGPIPE, &on, sizeof(on));
+       #endif
+
+        const juce::ScopedLock sl(sessionLock);
+        sessions.add(new Session(*this, client))->startThread();
+    }
+}
+
+void RenderService::reapFinishedSessions()
+{
+    const juce::ScopedLock sl(sessionLock);
+    for (int i = sessions.size(); --i >= 0;) {
+        if (sessions[i]->isFinished()) {
+            sessions.remove(i);
+        }
+    }
+}
+
+#endif
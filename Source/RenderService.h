@@ -0,0 +1,126 @@
+/*
+  ==============================================================================
+    RenderService.h
+    Created: 12 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Headless render service for batch stem processing: clients stream audio
+    chunks plus plug-in state over a Unix domain socket and get the results
+    back in shared memory (protocol in RenderProtocol.h), instead of writing
+    WAV files and starting a renderer per job.
+     - ProcessorPool keeps DelayAudioProcessor instances prepared ("warm"),
+       so a session starts without constructing or allocating anything when
+       the sample rate and block size match a pooled instance,
+     - each connection is a Session thread that owns one pooled processor
+       and one shared memory ring; the audio is processed in place in the
+       ring (processBlock on an AudioBuffer that points into it), so no
+       sample is copied on the way in or out,
+     - processors go back to the pool with the default state restored.
+     - state changes and prepareToPlay run on the message thread (the
+       sessions wait for it), since the processors' parameter trees are
+       also written by the APVTS timer there; processBlock runs on the
+       session thread like on a host's audio thread.
+    POSIX only (Linux / macOS), and only compiled with DELAY_RENDER_DAEMON=1
+    (the daemon and test targets), so the plug-in doesn't carry it. The
+    executable is RenderDaemon.cpp.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+#if DELAY_RENDER_DAEMON && ! JUCE_WINDOWS
+
+#include "PluginProcessor.h"
+#include "RenderProtocol.h"
+
+class ProcessorPool
+{
+public:
+    // Create and prepare numWarm processors up front (message thread).
+    // parallelChannels: processors split their two channels across two cores.
+    ProcessorPool(int numWarm, double sampleRate, int maxBlockSize, bool parallelChannels);
+
+    // A processor prepared for sampleRate / maxBlockSize (any thread; preparing runs on
+    // the message thread). Prefers a pooled one that already is; creates a new one if
+    // the pool is empty. nullptr if the service is stopping.
+    std::unique_ptr<DelayAudioProcessor> acquire(double sampleRate, int maxBlockSize);
+
+    // Back to the pool, with the default parameters and silent delay lines (any thread).
+    // If the service is stopping, the reset is left to the next acquire.
+    void release(std::unique_ptr<DelayAudioProcessor> processor);
+
+    int getNumIdle() const;
+
+private:
+    // setRateAndBufferSizeDetails + prepareToPlay, so getSampleRate() / getBlockSize()
+    // tell what a pooled processor is prepared for (message thread)
+    void prepare(DelayAudioProcessor& processor, double sampleRate, int maxBlockSize);
+
+    // default parameters, then prepare (message thread)
+    void restoreDefaults(DelayAudioProcessor& processor, double sampleRate, int maxBlockSize);
+
+    struct IdleProcessor
+    {
+        std::unique_ptr<DelayAudioProcessor> processor;
+        bool needsReset = false;        // released while stopping: still has a session's state
+    };
+
+    juce::CriticalSection lock;
+    std::vector<IdleProcessor> idle;
+    juce::MemoryBlock defaultState;     // state of a fresh processor
+    bool parallelChannels;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ProcessorPool)
+};
+
+class RenderService : private juce::Thread
+{
+public:
+    struct Options
+    {
+        juce::String socketPath = "/tmp/delay-render.sock";
+        int numWarmProcessors = 4;
+        double sampleRate = 48000.0;    // warm processors are prepared for this
+        int maxBlockSize = 4096;        // largest chunk a client may send
+        int maxSlots = 64;              // largest ring a client may ask for
+        bool parallelChannels = false;  // per-session parallel channel mode (see ChannelWorkerPool)
+    };
+
+    explicit RenderService(const Options& options);
+    ~RenderService() override;
+
+    // Create the warm pool and start listening (message thread). Returns false if the
+    // socket couldn't be opened; getLastError() says why.
+    bool start();
+
+    // Close the socket and end every session (their processors go back to the pool).
+    void stop();
+
+    const juce::String& getLastError() const noexcept { return lastError; }
+    int getNumSessions() const;
+
+private:
+    class Session;
+
+    void run() override;            // accept loop
+    void reapFinishedSessions();
+
+    Options options;
+    std::unique_ptr<ProcessorPool> pool;
+    int listenSocket = -1;
+    juce::String lastError;
+
+    juce::CriticalSection sessionLock;
+    juce::OwnedArray<Session> sessions;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (RenderService)
+};
+
+#endif
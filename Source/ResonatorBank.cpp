@@ -0,0 +1,239 @@
+/*
+  ==============================================================================
+    ResonatorBank.cpp
+    Created: 4 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the Karplus-Strong voice pool. The per-sample loop first
+    gathers each voice's four interpolation taps from the interleaved ring
+    (the only step where the lanes read different addresses), then runs the
+    interpolation, loop gain and both damping filters as straight loops over
+    the lanes and stores the new frame with one contiguous write.
+  ==============================================================================
+*/
+
+#include "ResonatorBank.h"
+#include "Core/DSP.h"     // interpolateCubic
+
+// Size the ring for the lowest note at this sample rate (or reserveSampleRate, if
+// higher). Only allocates when the ring has to grow.
+void ResonatorBank::prepare(double sampleRate, double reserveSampleRate)
+{
+    currentSampleRate = sampleRate;
+
+    double lowestHz = juce::MidiMessage::getMidiNoteInHertz(lowestNote);
+    double ringRate = juce::jmax(sampleRate, reserveSampleRate);
+    int longestPeriod = int(std::ceil(ringRate / lowestHz)) + 4;   // + interpolation taps
+    int frames = juce::nextPowerOfTwo(longestPeriod);              // wrap with a mask
+
+    if (frames > ringFrames) {
+        ring = pool->acquire(size_t(frames) * numVoices);
+        ringFrames = frames;
+    }
+
+    lastLowCut = -1.0f;  // coefficients depend on the sample rate
+    lastHighCut = -1.0f;
+
+    BufferPool::clear(ring.get(), size_t(ringFrames) * numVoices);
+    writeFrame = 0;
+    reset();
+}
+
+void ResonatorBank::release()
+{
+    ring.reset();
+    ringFrames = 0;
+}
+
+// Voice state only: the ring doesn't need clearing, since free voices are muted and
+// noteOn() overwrites everything a new voice reads during its first period.
+void ResonatorBank::reset() noexcept
+{
+    sustain.fill(0.0f);
+    excitation.fill(0.0f);
+    lowCutS1.fill(0.0f);
+    lowCutS2.fill(0.0f);
+    highCutS1.fill(0.0f);
+    highCutS2.fill(0.0f);
+    voiceNote.fill(-1);
+    voiceAge.fill(0);
+}
+
+// Same note again: retrigger its voice. Otherwise a free voice, then the oldest
+// released one, then the oldest held one (voice stealing).
+int ResonatorBank::findVoice(int noteNumber) const noexcept
+{
+    int freeVoice = -1;
+    int oldestReleased = -1;
+    int oldestHeld = 0;
+
+    for (int v = 0; v < numVoices; ++v) {
+        if (voiceNote[size_t(v)] == noteNumber) {
+            return v;
+        }
+        if (sustain[size_t(v)] == 0.0f) {
+            if (freeVoice < 0) {
+                freeVoice = v;
+            }
+        } else if (excitation[size_t(v)] == 0.0f) {
+            if (oldestReleased < 0 || voiceAge[size_t(v)] < voiceAge[size_t(oldestReleased)]) {
+                oldestReleased = v;
+            }
+        } else if (voiceAge[size_t(v)] < voiceAge[size_t(oldestHeld)]) {
+            oldestHeld = v;
+        }
+    }
+
+    if (freeVoice >= 0) {
+        return freeVoice;
+    }
+    return oldestReleased >= 0 ? oldestReleased : oldestHeld;
+}
+
+// Tune a voice to the note's period and pluck it: the history its taps will read
+// during the first period is filled with velocity-scaled white noise.
+void ResonatorBank::noteOn(int noteNumber, float velocity) noexcept
+{
+    if (!ring.isValid() || noteNumber < lowestNote || noteNumber > highestNote) {
+        return;
+    }
+
+    const int v = findVoice(noteNumber);
+    const auto lane = size_t(v);
+
+    float period = float(currentSampleRate / juce::MidiMessage::getMidiNoteInHertz(noteNumber));
+    delayInt[lane] = int(period);
+    delayFraction[lane] = period - float(delayInt[lane]);
+
+    sustain[lane] = 1.0f;
+    excitation[lane] = 1.0f;
+    lowCutS1[lane] = lowCutS2[lane] = 0.0f;
+    highCutS1[lane] = highCutS2[lane] = 0.0f;
+    voiceNote[lane] = noteNumber;
+    voiceAge[lane] = ++noteCounter;
+
+    float* data = ring.get();
+    const int mask = ringFrames - 1;
+    for (int k = 1; k <= delayInt[lane] + 2; ++k) {
+        int frame = (writeFrame - k) & mask;
+        data[size_t(frame) * numVoices + lane] = velocity * (random.nextFloat() * 2.0f - 1.0f);
+    }
+}
+
+// Released voices stop taking input and decay faster; process() frees them once silent.
+void ResonatorBank::noteOff(int noteNumber) noexcept
+{
+    for (size_t v = 0; v < size_t(numVoices); ++v) {
+        if (voiceNote[v] == noteNumber && excitation[v] > 0.0f) {
+            sustain[v] = releaseSustain;
+            excitation[v] = 0.0f;
+        }
+    }
+}
+
+void ResonatorBank::allNotesOff() noexcept
+{
+    for (size_t v = 0; v < size_t(numVoices); ++v) {
+        if (sustain[v] > 0.0f) {
+            sustain[v] = releaseSustain;
+            excitation[v] = 0.0f;
+        }
+    }
+}
+
+void ResonatorBank::setDamping(float lowCut, float highCut) noexcept
+{
+    if (lowCut != lastLowCut) {
+        lowCutCoefficients = makeTptCoefficients(lowCut, currentSampleRate);
+        lastLowCut = lowCut;
+    }
+    if (highCut != lastHighCut) {
+        highCutCoefficients = makeTptCoefficients(highCut, currentSampleRate);
+        lastHighCut = highCut;
+    }
+}
+
+void ResonatorBank::process(float* io, int numSamples, float feedback) noexcept
+{
+    if (!ring.isValid()) {
+        juce::FloatVectorOperations::clear(io, numSamples);
+        return;
+    }
+
+    float* data = ring.get();
+    const int mask = ringFrames - 1;
+    const TptCoefficients lc = lowCutCoefficients;
+    const TptCoefficients hc = highCutCoefficients;
+
+    // Work on local copies of the lane state: the compiler can then prove that the
+    // ring stores below don't alias it and keeps the lane loops vectorized.
+    Lanes<float> gain, input, fraction, audible;
+    Lanes<float> ls1 = lowCutS1, ls2 = lowCutS2, hs1 = highCutS1, hs2 = highCutS2;
+    Lanes<float> tapA, tapB, tapC, tapD, voiceOut;
+    Lanes<float> voicePeak {};
+
+    // Loop gain per voice. The input is scaled by 1 - gain so a voice peaks at about
+    // unity at its resonance, however high the feedback.
+    float loopGain = std::min(std::abs(feedback), 0.999f);
+    for (size_t v = 0; v < size_t(numVoices); ++v) {
+        gain[v] = loopGain * sustain[v];
+        input[v] = excitation[v] * (1.0f - gain[v]);
+        fraction[v] = delayFraction[v];
+        audible[v] = sustain[v] > 0.0f ? 1.0f : 0.0f; // free lanes may still hold old samples
+    }
+
+    for (int i = 0; i < numSamples; ++i) {
+        const int w = writeFrame;
+
+        // gather: each voice reads at its own period (the only scalar step)
+        for (size_t v = 0; v < size_t(numVoices); ++v) {
+            int a = w - delayInt[v] + 1;
+            tapA[v] = data[size_t(a & mask) * numVoices + v];
+            tapB[v] = data[size_t((a - 1) & mask) * numVoices + v];
+            tapC[v] = data[size_t((a - 2) & mask) * numVoices + v];
+            tapD[v] = data[size_t((a - 3) & mask) * numVoices + v];
+        }
+
+        const float x = io[i];
+        float* frame = data + size_t(w) * numVoices;
+
+        // all lanes at once: interpolation, loop gain, low cut, high cut, write
+        for (size_t v = 0; v < size_t(numVoices); ++v) {
+            float y = interpolateCubic(tapA[v], tapB[v], tapC[v], tapD[v], fraction[v]);
+            voiceOut[v] = y;
+            voicePeak[v] = std::max(voicePeak[v], std::abs(y));
+
+            // low cut (high-pass output), then high cut (low-pass output)
+            float hp = tptTick(y * gain[v], lc.g, lc.R2, lc.h, ls1[v], ls2[v]).highpass;
+            float lp = tptTick(hp, hc.g, hc.R2, hc.h, hs1[v], hs2[v]).lowpass;
+
+            frame[v] = x * input[v] + lp;
+        }
+
+        float sum = 0.0f;
+        for (size_t v = 0; v < size_t(numVoices); ++v) {
+            sum += voiceOut[v] * audible[v];
+        }
+        io[i] = sum;
+
+        writeFrame = (w + 1) & mask;
+    }
+
+    lowCutS1 = ls1;
+    lowCutS2 = ls2;
+    highCutS1 = hs1;
+    highCutS2 = hs2;
+
+    // free released voices that have died away
+    for (size_t v = 0; v < size_t(numVoices); ++v) {
+        if (excitation[v] == 0.0f && sustain[v] > 0.0f && voicePeak[v] < silenceThreshold) {
+            sustain[v] = 0.0f;
+            voiceNote[v] = -1;
+        }
+    }
+}
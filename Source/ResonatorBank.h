@@ -0,0 +1,97 @@
+/*
+  ==============================================================================
+    ResonatorBank.h
+    Created: 4 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Karplus-Strong resonator for the MIDI-driven resonator mode. Every note-on
+    takes a voice from a fixed pool of numVoices, tunes its short delay loop
+    to the note's period and plucks it; the input signal keeps exciting all
+    sounding voices, so the bank also rings along with the audio.
+     - the loop of each voice is: fractional delay (same cubic interpolation
+       as DelayLine) -> feedback gain -> low cut / high cut damping (the same
+       2-pole TPT state variable filters as the delay's feedback path),
+     - voices are SIMD lanes: all voices share one interleaved ring (frame *
+       numVoices + voice) and every step after the tap gather is a fixed
+       numVoices-iteration loop over structure-of-arrays state, which the
+       compiler turns into numVoices / 4 SSE / NEON operations. The whole
+       pool always runs, so 16 voices cost about as much as 4 scalar ones
+       and the CPU load doesn't depend on how many notes are held,
+     - the ring comes from the shared BufferPool.
+    prepare / release allocate and are for prepareToPlay / releaseResources;
+    everything else is real-time safe.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "BufferPool.h"   // shared, recycled sample memory
+#include "Core/TptFilter.h" // state variable filter step for the damping
+
+class ResonatorBank
+{
+public:
+    static constexpr int numVoices = 16;
+    static constexpr int lowestNote = 24;   // C1 (32.7 Hz): sets the ring length
+    static constexpr int highestNote = 108; // C8 (4186 Hz)
+
+    ResonatorBank() = default;
+
+    // reserveSampleRate: size the ring for this rate already, so a later prepare at a
+    // higher rate (up to it) doesn't allocate
+    void prepare(double sampleRate, double reserveSampleRate = 0.0);
+    void release();
+    void reset() noexcept;                  // free (silence) all voices at once
+
+    void noteOn(int noteNumber, float velocity) noexcept;
+    void noteOff(int noteNumber) noexcept;
+    void allNotesOff() noexcept;            // release every voice (they ring out)
+
+    // Damping filter cutoffs (Hz), shared by all voices
+    void setDamping(float lowCut, float highCut) noexcept;
+
+    // Replace the excitation signal in io with the summed voices. feedback is the
+    // loop gain of held notes (its magnitude is used, so the tuning never flips).
+    void process(float* io, int numSamples, float feedback) noexcept;
+
+private:
+    int findVoice(int noteNumber) const noexcept;
+
+    juce::SharedResourcePointer<BufferPool> pool; // declared first: outlives the ring below
+    BufferPool::Buffer ring;     // interleaved voice history: ring[frame * numVoices + voice]
+    int ringFrames = 0;          // power of two
+    int writeFrame = 0;          // frame written by the next sample
+    double currentSampleRate = 44100.0;
+
+    TptCoefficients lowCutCoefficients, highCutCoefficients; // shared by all lanes
+    float lastLowCut = -1.0f;
+    float lastHighCut = -1.0f;
+
+    // Per-voice (lane) state, structure of arrays
+    template <typename T>
+    using Lanes = std::array<T, numVoices>;
+
+    Lanes<int> delayInt {};                  // period: integer part (samples)
+    Lanes<float> delayFraction {};           // period: fractional part
+    Lanes<float> sustain {};                 // 1 while held, releaseSustain after note-off, 0 when free
+    Lanes<float> excitation {};              // input gain: 1 while held, 0 once released
+    Lanes<float> lowCutS1 {}, lowCutS2 {};   // filter states
+    Lanes<float> highCutS1 {}, highCutS2 {};
+
+    // Voice allocation (audio thread only)
+    Lanes<int> voiceNote {};                 // -1 = free
+    Lanes<juce::uint32> voiceAge {};         // note-on order, oldest is stolen first
+    juce::uint32 noteCounter = 0;
+    juce::Random random;                     // pluck noise
+
+    static constexpr float releaseSustain = 0.8f;  // extra loop gain after note-off
+    static constexpr float silenceThreshold = 1.0e-4f;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ResonatorBank)
+};
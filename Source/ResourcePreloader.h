@@ -0,0 +1,54 @@
+/*
+  ==============================================================================
+    ResourcePreloader.h
+    Created: 30 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:   header-only helper. Nothing UI-related is created when the plug-in
+            library loads or a processor is instantiated; the typeface and the
+            PNGs are decoded on first use. The editor starts this thread when it
+            opens so the decoding runs while the components are being built,
+            and the first paint finds everything in the caches.
+            (ImageCache and the function-local typeface are both thread-safe;
+            if paint gets there first it simply decodes them itself.)
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "LookAndFeel.h"    // Fonts
+
+class ResourcePreloader : private juce::Thread
+{
+public:
+    // Off only in the editor-open benchmark (EditorOpenTest), to time the path where
+    // the first paint decodes everything itself.
+    static inline std::atomic<bool> enabled { true };
+
+    ResourcePreloader() : juce::Thread("Resource Preloader")
+    {
+        if (enabled.load()) {
+            startThread(juce::Thread::Priority::background);
+        }
+    }
+
+    ~ResourcePreloader() override
+    {
+        stopThread(-1); // decoding a few images is short: always let it finish
+    }
+
+private:
+    void run() override
+    {
+        Fonts::getTypeface();
+        juce::ImageCache::getFromMemory(BinaryData::aurora_png, BinaryData::aurora_pngSize);
+        juce::ImageCache::getFromMemory(BinaryData::Logo_png, BinaryData::Logo_pngSize);
+    }
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ResourcePreloader)
+};
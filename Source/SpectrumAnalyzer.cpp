@@ -0,0 +1,199 @@
+/*
+  ==============================================================================
+    SpectrumAnalyzer.cpp
+    Created: 16 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Implements the background spectrum analysis. Every hopSize new samples
+    the worker windows the most recent fftSize samples of each stream,
+    transforms them, reads the magnitude at 256 log-spaced frequencies and
+    lets the display fall slowly (fast attack / slow release, like the meter).
+  ==============================================================================
+*/
+
+#include "SpectrumAnalyzer.h"
+
+SpectrumAnalyzer::SpectrumAnalyzer() : juce::Thread("Spectrum Analyzer")
+{
+    for (auto& points : smoothed) {
+        points.fill(mindB);
+    }
+}
+
+SpectrumAnalyzer::~SpectrumAnalyzer()
+{
+    stopThread(1000);
+}
+
+// Called from prepareToPlay, so the audio thread isn't running. The FIFO storage is
+// only allocated once; the worker never reads it before push() published samples.
+void SpectrumAnalyzer::prepare(double sampleRate) noexcept
+{
+    currentSampleRate.store(sampleRate);
+
+    if (fifoBuffer.getNumSamples() == 0) {
+        fifoBuffer.setSize(numStreams, fifoSize);
+    }
+}
+
+void SpectrumAnalyzer::push(const float* inputData, const float* feedbackData, int numSamples) noexcept
+{
+    if (fifoBuffer.getNumSamples() == 0) {
+        return; // not prepared yet
+    }
+
+    const auto scope = fifo.write(std::min(numSamples, fifo.getFreeSpace()));
+
+    if (scope.blockSize1 > 0) {
+        fifoBuffer.copyFrom(input, scope.startIndex1, inputData, scope.blockSize1);
+        fifoBuffer.copyFrom(feedback, scope.startIndex1, feedbackData, scope.blockSize1);
+    }
+    if (scope.blockSize2 > 0) {
+        fifoBuffer.copyFrom(input, scope.startIndex2, inputData + scope.blockSize1, scope.blockSize2);
+        fifoBuffer.copyFrom(feedback, scope.startIndex2, feedbackData + scope.blockSize1, scope.blockSize2);
+    }
+}
+
+void SpectrumAnalyzer::start()
+{
+    startThread(juce::Thread::Priority::low);
+}
+
+void SpectrumAnalyzer::stop()
+{
+    stopThread(1000);
+}
+
+bool SpectrumAnalyzer::getLatestPaths(juce::Path& inputPath, juce::Path& feedbackPath)
+{
+    if (!newPathsReady.exchange(false)) {
+        return false;
+    }
+
+    const juce::SpinLock::ScopedLockType lock(pathLock);
+    inputPath = readyPaths[input];
+    feedbackPath = readyPaths[feedback];
+    return true;
+}
+
+void SpectrumAnalyzer::run()
+{
+    // FFT tables and history are only needed once somebody looks at the analyzer
+    if (fft == nullptr) {
+        fft = std::make_unique<juce::dsp::FFT>(fftOrder);
+        window = std::make_unique<juce::dsp::WindowingFunction<float>>(
+            size_t(fftSize), juce::dsp::WindowingFunction<float>::hann);
+        history.setSize(numStreams, fftSize);
+        history.clear();
+    }
+
+    fifo.read(fifo.getNumReady()); // skip whatever piled up while nobody was looking
+
+    while (!threadShouldExit()) {
+        double sampleRate = currentSampleRate.load();
+        if (sampleRate != analysedSampleRate) {
+            updatePointBins(sampleRate);
+        }
+
+        bool analysed = false;
+
+        // Move new samples from the FIFO into the history ring, one hop at a time
+        while (fifo.getNumReady() > 0 && !threadShouldExit()) {
+            const auto scope = fifo.read(std::min(fifo.getNumReady(), hopSize - samplesSinceLastFFT));
+            auto copyToHistory = [this](int start, int size)
+            {
+                for (int i = 0; i < size; ++i) {
+                    for (int stream = 0; stream < numStreams; ++stream) {
+                        history.setSample(stream, historyIndex, fifoBuffer.getSample(stream, start + i));
+                    }
+                    historyIndex = (historyIndex + 1) % fftSize;
+                }
+            };
+            copyToHistory(scope.startIndex1, scope.blockSize1);
+            copyToHistory(scope.startIndex2, scope.blockSize2);
+
+            samplesSinceLastFFT += scope.blockSize1 + scope.blockSize2;
+            if (samplesSinceLastFFT >= hopSize) {
+                samplesSinceLastFFT = 0;
+                analyse(input);
+                analyse(feedback);
+                analysed = true;
+            }
+        }
+
+        if (analysed) {
+            juce::Path paths[numStreams];
+            buildPath(input, paths[input]);
+            buildPath(feedback, paths[feedback]);
+
+            const juce::SpinLock::ScopedLockType lock(pathLock);
+            std::swap(readyPaths[input], paths[input]);
+            std::swap(readyPaths[feedback], paths[feedback]);
+            newPathsReady.store(true);
+        }
+
+        wait(10); // ~2 hops at 48 kHz; the UI only refreshes at 60 Hz anyway
+    }
+}
+
+// Map each display point (log-spaced 20 Hz .. 20 kHz) to a fractional FFT bin.
+void SpectrumAnalyzer::updatePointBins(double sampleRate)
+{
+    analysedSampleRate = sampleRate;
+
+    const float binWidth = float(sampleRate) / float(fftSize);
+    const float maxBin = float(fftSize / 2 - 1);
+    for (int p = 0; p < numPoints; ++p) {
+        float hz = 20.0f * std::pow(1000.0f, float(p) / float(numPoints - 1));
+        pointBins[size_t(p)] = std::min(hz / binWidth, maxBin);
+    }
+}
+
+void SpectrumAnalyzer::analyse(int stream)
+{
+    // Unroll the ring so the oldest sample comes first
+    const float* samples = history.getReadPointer(stream);
+    int tail = fftSize - historyIndex;
+    std::copy(samples + historyIndex, samples + fftSize, fftData.begin());
+    std::copy(samples, samples + historyIndex, fftData.begin() + tail);
+    std::fill(fftData.begin() + fftSize, fftData.end(), 0.0f);
+
+    window->multiplyWithWindowingTable(fftData.data(), size_t(fftSize));
+    fft->performFrequencyOnlyForwardTransform(fftData.data());
+
+    // The window is normalised to unit mean, so a full-scale sine peaks at fftSize / 2
+    const float norm = 2.0f / float(fftSize);
+    const float release = 0.5f; // dB per analysis frame (~47 dB/s at 48 kHz)
+
+    auto& points = smoothed[size_t(stream)];
+    for (int p = 0; p < numPoints; ++p) {
+        float bin = pointBins[size_t(p)];
+        int index = int(bin);
+        float fraction = bin - float(index);
+        float magnitude = fftData[size_t(index)] + (fftData[size_t(index + 1)] - fftData[size_t(index)]) * fraction;
+
+        float db = juce::Decibels::gainToDecibels(magnitude * norm, mindB);
+        points[size_t(p)] = std::max(db, points[size_t(p)] - release);
+    }
+}
+
+void SpectrumAnalyzer::buildPath(int stream, juce::Path& path) const
+{
+    const auto& points = smoothed[size_t(stream)];
+
+    path.preallocateSpace(numPoints * 3 + 4);
+    for (int p = 0; p < numPoints; ++p) {
+        float x = float(p) / float(numPoints - 1);
+        float y = juce::jmap(juce::jlimit(mindB, maxdB, points[size_t(p)]), mindB, maxdB, 1.0f, 0.0f);
+        if (p == 0) {
+            path.startNewSubPath(x, y);
+        } else {
+            path.lineTo(x, y);
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*
+  ==============================================================================
+    SpectrumAnalyzer.h
+    Created: 16 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Spectrum of the dry input and of the feedback path, for tuning the
+    Low Cut / High Cut filters by eye.
+     - audio thread: push() copies a block of samples into a lock-free FIFO,
+       nothing else.
+     - worker thread: windowing, FFT, dB conversion, smoothing and building
+       the display paths.
+     - UI thread: picks up the finished paths and draws them.
+    The worker only runs while an editor shows the analyzer (start/stop).
+    Nothing big is allocated in the constructor: the FIFO storage is created
+    in prepare() and the FFT tables when the worker first runs, so instances
+    that never open an editor (or are only scanned) don't pay for them.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+
+class SpectrumAnalyzer : private juce::Thread
+{
+public:
+    static constexpr int fftOrder = 11;               // 2048-point FFT
+    static constexpr int fftSize = 1 << fftOrder;
+    static constexpr int hopSize = fftSize / 4;       // 75% overlap between analysis windows
+    static constexpr int numPoints = 256;             // log-spaced display points (20 Hz .. 20 kHz)
+    static constexpr float mindB = -90.0f;            // bottom of the display range
+    static constexpr float maxdB = 0.0f;              // top of the display range
+
+    SpectrumAnalyzer();
+    ~SpectrumAnalyzer() override;
+
+    // Audio side (prepareToPlay): tell the worker which sample rate the data has.
+    void prepare(double sampleRate) noexcept;
+
+    // Audio thread: copy numSamples of dry input and feedback-path signal into the FIFO.
+    // Lock-free and allocation-free; samples that don't fit (worker stopped) are dropped.
+    void push(const float* inputData, const float* feedbackData, int numSamples) noexcept;
+
+    // Any thread: sample rate of the analysed data (as last passed to prepare)
+    double getSampleRate() const noexcept
+    {
+        return currentSampleRate.load();
+    }
+
+    // UI thread: start / stop the worker (while an editor is showing the analyzer).
+    void start();
+    void stop();
+
+    // UI thread: copy the latest paths if the worker produced new ones since the last call.
+    // Paths are in a unit square (x = log frequency, y = 0 at maxdB .. 1 at mindB).
+    bool getLatestPaths(juce::Path& inputPath, juce::Path& feedbackPath);
+
+private:
+    enum Stream { input = 0, feedback = 1, numStreams };
+
+    void run() override;                 // worker loop
+    void updatePointBins(double sampleRate);
+    void analyse(int stream);            // window + FFT + smoothing for one stream
+    void buildPath(int stream, juce::Path& path) const;
+
+    // --- shared between audio thread and worker (lock-free) ---
+    static constexpr int fifoSize = fftSize * 8;
+    juce::AbstractFifo fifo { fifoSize };
+    juce::AudioBuffer<float> fifoBuffer;                     // allocated in prepare()
+    std::atomic<double> currentSampleRate { 44100.0 };
+
+    // --- worker thread only ---
+    std::unique_ptr<juce::dsp::FFT> fft;                       // created on first run()
+    std::unique_ptr<juce::dsp::WindowingFunction<float>> window;
+    juce::AudioBuffer<float> history;                          // last fftSize samples (ring)
+    int historyIndex = 0;                                      // next slot to overwrite
+    int samplesSinceLastFFT = 0;
+    std::array<float, fftSize * 2> fftData {};                // FFT works in place, needs 2N
+    std::array<float, numPoints> pointBins {};                // fractional FFT bin per display point
+    std::array<std::array<float, numPoints>, numStreams> smoothed {}; // smoothed dB per point
+    double analysedSampleRate = 0.0;
+
+    // --- handoff from worker to UI (never touched by the audio thread) ---
+    juce::SpinLock pathLock;
+    juce::Path readyPaths[numStreams];
+    std::atomic<bool> newPathsReady { false };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumAnalyzer)
+};
@@ -0,0 +1,70 @@
+/*
+  ==============================================================================
+    SpectrumView.cpp
+    Created: 16 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    The analyzer paths are produced in a unit square, so paint() only applies
+    a scale transform; no spectrum math happens on the message thread.
+    The filter response is checked once per frame but only recomputed when
+    the Low Cut / High Cut values (or the sample rate) changed.
+    The analyzer worker only runs while the view is actually on screen.
+  ==============================================================================
+*/
+
+#include "SpectrumView.h"
+#include "LookAndFeel.h"    // colours
+
+SpectrumView::SpectrumView(SpectrumAnalyzer& analyzer_,
+                           const std::atomic<float>& lowCut_,
+                           const std::atomic<float>& highCut_)
+    : analyzer(analyzer_), lowCut(lowCut_), highCut(highCut_)
+{
+    setOpaque(true); // the analyzer worker is started once the view is on screen (refreshAttachment)
+}
+
+SpectrumView::~SpectrumView()
+{
+    analyzer.stop();
+}
+
+void SpectrumView::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+    auto toBounds = juce::AffineTransform::scale(bounds.getWidth(), bounds.getHeight())
+                                          .translated(bounds.getX(), bounds.getY());
+
+    g.fillAll(Colors::Spectrum::background);
+
+    // feedback path filled underneath, dry input as a line on top
+    juce::Path feedbackArea(feedbackPath);
+    if (!feedbackArea.isEmpty()) {
+        feedbackArea.lineTo(1.0f, 1.0f);
+        feedbackArea.lineTo(0.0f, 1.0f);
+        feedbackArea.closeSubPath();
+        g.setColour(Colors::Spectrum::feedback);
+        g.fillPath(feedbackArea, toBounds);
+    }
+
+    g.setColour(Colors::Spectrum::input);
+    g.strokePath(inputPath, juce::PathStrokeType(1.0f), toBounds);
+
+    // combined Low Cut + High Cut response on top
+    g.setColour(Colors::Spectrum::response);
+    g.strokePath(response.getPath(), juce::PathStrokeType(2.0f), toBounds);
+}
+
+void SpectrumView::refresh()
+{
+    bool newSpectrum = analyzer.getLatestPaths(inputPath, feedbackPath);
+    bool newResponse = response.update(lowCut.load(), highCut.load(), analyzer.getSampleRate());
+
+    if (newSpectrum || newResponse) {
+        repaint();
+    }
+}
@@ -0,0 +1,56 @@
+/*
+  ==============================================================================
+    SpectrumView.h
+    Created: 16 Mar 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Analyzer overlay for the Feedback group: dry input spectrum vs. the
+    spectrum of the feedback path. Only draws paths that SpectrumAnalyzer
+    computed on its worker thread. On top sits the Low Cut / High Cut
+    response curve, recomputed only when a cutoff changes.
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <JuceHeader.h>
+#include "SpectrumAnalyzer.h"   // background FFT worker
+#include "FilterResponse.h"     // cached tone filter response curve
+#include "RefreshScheduler.h"   // shared per-frame UI clock
+
+class SpectrumView : public juce::Component
+{
+public:
+    // analyzer: background FFT worker (runs only while this view is on screen)
+    // lowCut / highCut: cutoffs (Hz) the audio is using, i.e. after morphing, for the response curve
+    SpectrumView(SpectrumAnalyzer& analyzer,
+                 const std::atomic<float>& lowCut,
+                 const std::atomic<float>& highCut);
+    ~SpectrumView() override;                          // stops the worker
+
+    void paint(juce::Graphics&) override;
+
+private:
+    void refresh(); // per-frame: fetch new paths from the worker, update the response curve
+
+    SpectrumAnalyzer& analyzer;
+    const std::atomic<float>& lowCut;
+    const std::atomic<float>& highCut;
+
+    FilterResponse response;  // tone filter curve, cached as a path between cutoff changes
+
+    juce::Path inputPath;     // dry input spectrum (unit square)
+    juce::Path feedbackPath;  // feedback-path spectrum (unit square)
+
+    // Per-frame updates driven by the shared scheduler (declared last: it calls refresh())
+    RefreshScheduler::Attachment refreshAttachment {
+        *this, [this] { refresh(); },
+        [this](bool showing) { showing ? analyzer.start() : analyzer.stop(); } // no FFTs while hidden
+    };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SpectrumView)
+};
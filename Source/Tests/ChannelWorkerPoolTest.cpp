@@ -0,0 +1,90 @@
+/*
+  ==============================================================================
+    ChannelWorkerPoolTest.cpp
+    Created: 17 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Parallel channel mode only pays off if the worker actually runs the
+    second channel while the audio thread runs the first. Runs 200 blocks
+    at a realistic block period (512 samples at 48 kHz) with two 1 ms tasks
+    each, and counts the blocks where both tasks ran on different threads
+    at the same time; logs the mean run() time against the 2 ms it takes
+    on one thread (category "Benchmark": needs at least two free cores).
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS
+
+#include <JuceHeader.h>
+#include "../ChannelWorkerPool.h"
+
+class ChannelWorkerPoolTest : public juce::UnitTest
+{
+public:
+    ChannelWorkerPoolTest() : juce::UnitTest("Parallel channels run concurrently", "Benchmark") {}
+
+    void runTest() override
+    {
+        constexpr int numBlocks = 200;
+        constexpr double blockPeriodMs = 1000.0 * 512 / 48000.0;
+
+        beginTest("both channel tasks overlap");
+        if (juce::SystemStats::getNumCpus() < 2) {
+            logMessage("single core machine: nothing to measure");
+            return;
+        }
+
+        ChannelWorkerPool pool;
+        pool.prepare(2, 1000.0, 4.0 * blockPeriodMs);   // generous budget: measure, don't fall back
+        expectEquals(pool.getNumWorkers(), 1);
+
+        int concurrent = 0;
+        double total = 0.0;
+        for (int block = 0; block < numBlocks; ++block) {
+            Job job;
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            pool.run(&runTask, &job, 2);
+            total += juce::Time::getMillisecondCounterHiRes() - start;
+
+            bool overlapped = job.start[0] < job.end[1] && job.start[1] < job.end[0];
+            concurrent += (job.thread[0] != job.thread[1] && overlapped) ? 1 : 0;
+
+            // rest of the block period: the host is busy elsewhere
+            juce::Thread::sleep(juce::jmax(1, int(blockPeriodMs - (juce::Time::getMillisecondCounterHiRes() - start))));
+        }
+
+        logMessage(juce::String(concurrent) + " of " + juce::String(numBlocks) + " blocks ran both channels "
+                   + "concurrently; run() took " + juce::String(total / numBlocks, 3) + " ms on average ("
+                   + juce::String(2.0 * taskTimeMs, 1) + " ms on one thread)");
+        expect(concurrent > numBlocks * 3 / 4, "the worker runs the second channel in most blocks");
+        expect(!pool.isOverBudget());
+    }
+
+private:
+    static constexpr double taskTimeMs = 1.0;
+
+    struct Job
+    {
+        double start[2] {}, end[2] {};
+        juce::Thread::ThreadID thread[2] {};
+    };
+
+    // Stand-in for one channel's work: busy for taskTimeMs, records where and when it ran
+    static void runTask(void* context, int index)
+    {
+        auto& job = *static_cast<Job*>(context);
+        job.thread[index] = juce::Thread::getCurrentThreadId();
+        job.start[index] = juce::Time::getMillisecondCounterHiRes();
+        while (juce::Time::getMillisecondCounterHiRes() - job.start[index] < taskTimeMs) {}
+        job.end[index] = juce::Time::getMillisecondCounterHiRes();
+    }
+};
+
+static ChannelWorkerPoolTest channelWorkerPoolTest;
+
+#endif
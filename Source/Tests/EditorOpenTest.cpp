@@ -0,0 +1,98 @@
+/*
+  ==============================================================================
+    EditorOpenTest.cpp
+    Created: 17 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Plug-in load time and first-editor-open latency (category "Benchmark").
+     - constructing a processor must not decode any UI resources: checks
+       that the background image isn't in the ImageCache afterwards and
+       logs the first (shared pools created) and mean construction time,
+     - opening the editor is timed as the host sees it: createEditorIfNeeded
+       plus the first full paint (a component snapshot), with the
+       ResourcePreloader running and switched off. The image cache is
+       emptied before every open, so each one starts cold; the typeface is
+       a process-wide static and is only cold in the warm-up open, which is
+       logged on its own.
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS
+
+#include "../PluginProcessor.h"
+#include "../ResourcePreloader.h"
+
+class EditorOpenTest : public juce::UnitTest
+{
+public:
+    EditorOpenTest() : juce::UnitTest("Plug-in load and first editor open", "Benchmark") {}
+
+    void runTest() override
+    {
+        constexpr int numInstances = 100;
+        constexpr int numOpens = 10;
+
+        beginTest("processor construction decodes no UI resources");
+        juce::ImageCache::releaseUnusedImages();
+        std::vector<std::unique_ptr<DelayAudioProcessor>> processors;
+        auto start = juce::Time::getMillisecondCounterHiRes();
+        processors.push_back(std::make_unique<DelayAudioProcessor>());
+        double first = juce::Time::getMillisecondCounterHiRes() - start;
+        start = juce::Time::getMillisecondCounterHiRes();
+        for (int i = 1; i < numInstances; ++i) {
+            processors.push_back(std::make_unique<DelayAudioProcessor>());
+        }
+        double rest = juce::Time::getMillisecondCounterHiRes() - start;
+        expect(!isCached(BinaryData::aurora_png), "background image decoded by the processor");
+        logMessage("processor construction: first " + juce::String(first, 3) + " ms, then "
+                   + juce::String(rest / double(numInstances - 1), 3) + " ms mean");
+        processors.resize(1);
+
+        auto& processor = *processors.front();
+        logMessage("warm-up open (typeface decoded too): " + juce::String(openEditor(processor), 2) + " ms");
+
+        beginTest("first editor open, with and without the preloader");
+        double withPreloader = 0.0, withoutPreloader = 0.0;
+        for (int i = 0; i < numOpens; ++i) {            // interleaved, so drift hits both alike
+            ResourcePreloader::enabled = true;
+            withPreloader += openEditor(processor);
+            ResourcePreloader::enabled = false;
+            withoutPreloader += openEditor(processor);
+        }
+        ResourcePreloader::enabled = true;
+        logMessage("editor open + first paint, mean of " + juce::String(numOpens) + ": "
+                   + juce::String(withPreloader / numOpens, 2) + " ms with the preloader, "
+                   + juce::String(withoutPreloader / numOpens, 2) + " ms without");
+    }
+
+private:
+    // ImageCache::getFromMemory keys the cache on the data pointer
+    static bool isCached(const void* imageData)
+    {
+        return juce::ImageCache::getFromHashCode(juce::int64(juce::pointer_sized_int(imageData))).isValid();
+    }
+
+    // Cold open: empty image cache, create the editor the way a host does, paint it
+    // once. Returns the elapsed time in ms.
+    static double openEditor(DelayAudioProcessor& processor)
+    {
+        juce::ImageCache::releaseUnusedImages();
+
+        auto start = juce::Time::getMillisecondCounterHiRes();
+        std::unique_ptr<juce::AudioProcessorEditor> editor(processor.createEditorIfNeeded());
+        auto snapshot = editor->createComponentSnapshot(editor->getLocalBounds());
+        double elapsed = juce::Time::getMillisecondCounterHiRes() - start;
+
+        editor.reset();
+        return elapsed;
+    }
+};
+
+static EditorOpenTest editorOpenTest;
+
+#endif
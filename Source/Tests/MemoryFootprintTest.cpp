@@ -0,0 +1,81 @@
+/*
+  ==============================================================================
+    MemoryFootprintTest.cpp
+    Created: 14 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    A session where most tracks are inactive: prepares a set of processors,
+    releases all but a few (what hosts do for deactivated / frozen tracks)
+    and checks that the delay memory in use drops accordingly, and that
+    preparing them again is served from the BufferPool cache.
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS
+
+#include "../PluginProcessor.h"
+
+class MemoryFootprintTest : public juce::UnitTest
+{
+public:
+    MemoryFootprintTest() : juce::UnitTest("Memory footprint", "Delay") {}
+
+    void runTest() override
+    {
+        constexpr int numTracks = 16;
+        constexpr int numActive = 2;
+        constexpr double sampleRate = 48000.0;
+        constexpr int blockSize = 512;
+
+        juce::SharedResourcePointer<BufferPool> pool;
+        const auto baseline = pool->getStats().bytesInUse;
+
+        beginTest("releaseResources gives the delay memory of inactive tracks back");
+
+        std::vector<std::unique_ptr<DelayAudioProcessor>> tracks;
+        for (int i = 0; i < numTracks; ++i) {
+            tracks.push_back(std::make_unique<DelayAudioProcessor>());
+            tracks.back()->prepareToPlay(sampleRate, blockSize);
+        }
+        const auto allActive = pool->getStats().bytesInUse - baseline;
+        expect(allActive > 0);
+
+        for (int i = numActive; i < numTracks; ++i) {
+            tracks[size_t(i)]->releaseResources();
+        }
+        const auto stats = pool->getStats();
+        const auto mostlyInactive = stats.bytesInUse - baseline;
+
+        // every track holds the same buffers, so what's left is exactly the active share
+        expectEquals(juce::int64(mostlyInactive * numTracks), juce::int64(allActive * numActive));
+        logMessage("in use with " + juce::String(numTracks) + " active tracks: "
+                   + juce::String(juce::int64(allActive / 1024)) + " KiB, with "
+                   + juce::String(numActive) + " active: "
+                   + juce::String(juce::int64(mostlyInactive / 1024)) + " KiB ("
+                   + juce::String(juce::int64(stats.bytesCached / 1024)) + " KiB cached for "
+                   + juce::String(BufferPool::cacheHoldTime / 1000) + " s)");
+
+        beginTest("re-preparing within the hold time reuses the cached blocks");
+
+        const int reusedBefore = pool->getStats().numReused;
+        const int acquiresBefore = pool->getStats().numAcquires;
+        for (int i = numActive; i < numTracks; ++i) {
+            tracks[size_t(i)]->prepareToPlay(sampleRate, blockSize);
+        }
+        const auto after = pool->getStats();
+        expectEquals(after.numReused - reusedBefore, after.numAcquires - acquiresBefore);
+        expectEquals(juce::int64(after.bytesInUse - baseline), juce::int64(allActive));
+
+        tracks.clear();
+        expectEquals(juce::int64(pool->getStats().bytesInUse), juce::int64(baseline));
+    }
+};
+
+static MemoryFootprintTest memoryFootprintTest;
+
+#endif
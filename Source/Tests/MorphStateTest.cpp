@@ -0,0 +1,87 @@
+/*
+  ==============================================================================
+    MorphStateTest.cpp
+    Created: 17 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    The A/B morph slots are saved in the plug-in state as raw snapshot
+    floats. Checks the round trip, that a slot saved before values were
+    appended to the snapshot (a shorter blob) comes back with the defaults
+    filled in, and that only a malformed blob is dropped.
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS
+
+#include "../PluginProcessor.h"
+
+class MorphStateTest : public juce::UnitTest
+{
+public:
+    MorphStateTest() : juce::UnitTest("Morph slots in the plug-in state", "Delay") {}
+
+    void runTest() override
+    {
+        beginTest("round trip");
+        {
+            DelayAudioProcessor source;
+            setDelayTime(source, 250.0f);
+            source.storeMorphSlot(Parameters::morphA);
+            setDelayTime(source, 800.0f);
+            source.storeMorphSlot(Parameters::morphB);
+
+            DelayAudioProcessor restored;
+            copyState(source, restored);
+            for (int slot = 0; slot < Parameters::numMorphSlots; ++slot) {
+                expect(restored.params.hasMorphSlot(slot));
+                expect(restored.params.getMorphSlot(slot).values == source.params.getMorphSlot(slot).values);
+            }
+        }
+
+        beginTest("a shorter slot (older snapshot layout) keeps its values, defaults fill the rest");
+        {
+            constexpr int numOld = Parameters::numSnapshotValues - 2;
+            std::array<float, numOld> old;
+            for (int i = 0; i < numOld; ++i) {
+                old[size_t(i)] = float(i + 1);
+            }
+
+            DelayAudioProcessor source;
+            source.apvts.state.setProperty("morphA", juce::MemoryBlock(old.data(), sizeof(old)), nullptr);
+            source.apvts.state.setProperty("morphB", juce::MemoryBlock("abcde", 5), nullptr);  // not whole floats
+
+            DelayAudioProcessor restored;
+            copyState(source, restored);
+            expect(restored.params.hasMorphSlot(Parameters::morphA));
+            const auto defaults = Parameters::getDefaults().values;
+            const auto values = restored.params.getMorphSlot(Parameters::morphA).values;
+            for (int i = 0; i < Parameters::numSnapshotValues; ++i) {
+                expectEquals(values[size_t(i)], i < numOld ? old[size_t(i)] : defaults[size_t(i)]);
+            }
+            expect(!restored.params.hasMorphSlot(Parameters::morphB), "malformed slot dropped");
+        }
+    }
+
+private:
+    static void setDelayTime(DelayAudioProcessor& processor, float ms)
+    {
+        auto* param = processor.apvts.getParameter(delayTimeParamID.getParamID());
+        param->setValueNotifyingHost(param->convertTo0to1(ms));
+    }
+
+    static void copyState(DelayAudioProcessor& source, DelayAudioProcessor& destination)
+    {
+        juce::MemoryBlock state;
+        source.getStateInformation(state);
+        destination.setStateInformation(state.getData(), int(state.getSize()));
+    }
+};
+
+static MorphStateTest morphStateTest;
+
+#endif
@@ -0,0 +1,80 @@
+/*
+  ==============================================================================
+    PrepareLatencyTest.cpp
+    Created: 14 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    prepareToPlay latency of a 200-instance session, the way a host restarts
+    its engine: first prepare, re-prepare at the same settings, then a
+    sample-rate / block-size change up and back down. Logs the total and
+    the slowest instance for each pass (category "Benchmark", so it can be
+    run on its own: DelayTests Benchmark) and checks that no re-prepare
+    takes memory from the BufferPool: the delay buffers and the resonator
+    ring are reserved for 192 kHz on the first prepare.
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS
+
+#include "../PluginProcessor.h"
+
+class PrepareLatencyTest : public juce::UnitTest
+{
+public:
+    PrepareLatencyTest() : juce::UnitTest("prepareToPlay latency, 200 instances", "Benchmark") {}
+
+    void runTest() override
+    {
+        constexpr int numInstances = 200;
+
+        juce::SharedResourcePointer<BufferPool> pool;
+        std::vector<std::unique_ptr<DelayAudioProcessor>> session;
+        for (int i = 0; i < numInstances; ++i) {
+            session.push_back(std::make_unique<DelayAudioProcessor>());
+        }
+
+        beginTest("first prepare");
+        measure(session, 44100.0, 512);
+
+        beginTest("re-prepare, same settings");
+        const int acquires = pool->getStats().numAcquires;
+        measure(session, 44100.0, 512);
+        expectEquals(pool->getStats().numAcquires, acquires);
+
+        beginTest("re-prepare at 96 kHz / 1024");
+        measure(session, 96000.0, 1024);
+        expectEquals(pool->getStats().numAcquires, acquires);
+
+        beginTest("re-prepare back at 44.1 kHz / 256");
+        measure(session, 44100.0, 256);
+        expectEquals(pool->getStats().numAcquires, acquires);
+    }
+
+private:
+    // prepareToPlay every instance once; log total and worst-case time
+    void measure(std::vector<std::unique_ptr<DelayAudioProcessor>>& session, double sampleRate, int blockSize)
+    {
+        double total = 0.0;
+        double slowest = 0.0;
+        for (auto& processor : session) {
+            auto start = juce::Time::getMillisecondCounterHiRes();
+            processor->prepareToPlay(sampleRate, blockSize);
+            double elapsed = juce::Time::getMillisecondCounterHiRes() - start;
+            total += elapsed;
+            slowest = juce::jmax(slowest, elapsed);
+        }
+        logMessage(juce::String(int(session.size())) + " x prepareToPlay(" + juce::String(sampleRate)
+                   + ", " + juce::String(blockSize) + "): " + juce::String(total, 2) + " ms total, "
+                   + juce::String(total / double(session.size()), 3) + " ms mean, "
+                   + juce::String(slowest, 3) + " ms slowest");
+    }
+};
+
+static PrepareLatencyTest prepareLatencyTest;
+
+#endif
@@ -0,0 +1,328 @@
+/*
+  ==============================================================================
+    RenderServiceTest.cpp
+    Created: 17 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Runs the render service with the real DelayAudioProcessor and talks to it
+    over its socket the way a render-farm client does: requests before hello,
+    hello with a state blob, reset, a pipelined ring of slots, out-of-range
+    slots, goodbye, a second session (must get default parameters back) and
+    stop() with a client still connected. The client runs on its own thread;
+    the test thread is the message thread and keeps the message loop going,
+    since the sessions hand every state change over to it.
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS && DELAY_RENDER_DAEMON
+
+#include "../PluginProcessor.h"
+#include "../RenderService.h"
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+class RenderServiceTest : public juce::UnitTest
+{
+public:
+    RenderServiceTest() : juce::UnitTest("Render service", "Delay") {}
+
+    void runTest() override
+    {
+        const float gain = juce::Decibels::decibelsToGain(-6.0f);
+
+        // state blob for the first session: -6 dB output gain, everything else default
+        juce::MemoryBlock state;
+        {
+            DelayAudioProcessor source;
+            auto* param = source.apvts.getParameter(gainParamID.getParamID());
+            param->setValueNotifyingHost(param->convertTo0to1(-6.0f));
+            source.getStateInformation(state);
+        }
+
+        RenderService::Options options;
+        options.socketPath = "/tmp/delay-test-" + juce::String(getpid()) + ".sock";
+        options.numWarmProcessors = 1;
+        options.sampleRate = 48000.0;
+        options.maxBlockSize = blockSize;
+        options.maxSlots = numSlots;
+
+        RenderService service(options);
+        beginTest("start");
+        expect(service.start(), service.getLastError());
+
+        Client client(options.socketPath, state);
+        client.startThread();
+        runMessageLoopUntil([&] { return !client.isThreadRunning(); });
+        expect(!client.isThreadRunning(), "client finished");
+        client.stopThread(1000);
+
+        beginTest("requests before hello are refused");
+        expectEquals(int(client.beforeHello), int(RenderProtocol::badRequest));
+
+        beginTest("hello applies the state blob");
+        expectEquals(int(client.hello.status), int(RenderProtocol::ok));
+        expectEquals(int(client.hello.numSlots), numSlots);
+        expectEquals(int(client.hello.maxBlockSize), blockSize);
+        expect(client.mapped, "shared memory mapped");
+        expectEquals(int(client.reset), int(RenderProtocol::ok));
+
+        beginTest("pipelined slots come back in order, processed in place");
+        expectEquals(client.numReplies, numSlots);
+        expect(client.inOrder, "replies in request order");
+        for (int s = 0; s < numSlots; ++s) {
+            expectWithinAbsoluteError(client.slotOutput[s], input * gain, 1.0e-3f);
+        }
+
+        beginTest("out-of-range requests are refused, session stays open");
+        expectEquals(int(client.badSlot), int(RenderProtocol::badRequest));
+        expectEquals(int(client.tooLong), int(RenderProtocol::badRequest));
+        expectEquals(int(client.goodbye), int(RenderProtocol::ok));
+
+        beginTest("next session starts from default parameters");
+        expectEquals(int(client.secondHello), int(RenderProtocol::ok));
+        expectWithinAbsoluteError(client.secondOutput, input, 1.0e-3f);
+
+        beginTest("stop with a client connected");
+        runMessageLoopUntil([&] { return service.getNumSessions() == 1; });
+        expectEquals(service.getNumSessions(), 1);
+        auto start = juce::Time::getMillisecondCounter();
+        service.stop();
+        expect(juce::Time::getMillisecondCounter() - start < 2000, "stop() returned promptly");
+        expectEquals(service.getNumSessions(), 0);
+        expect(!juce::File(options.socketPath).exists(), "socket file removed");
+        client.disconnect();
+    }
+
+private:
+    static constexpr int numSlots = 4;
+    static constexpr int blockSize = 256;
+    static constexpr float input = 0.25f;     // constant, well inside the 100 ms default delay
+
+    // Pump the message loop (sessions run their state changes on it) until done() or 10 s
+    template <typename Predicate>
+    static void runMessageLoopUntil(Predicate done)
+    {
+        auto deadline = juce::Time::getMillisecondCounter() + 10000;
+        while (!done() && juce::Time::getMillisecondCounter() < deadline) {
+            juce::MessageManager::getInstance()->runDispatchLoopUntil(10);
+        }
+    }
+
+    // Render-farm client: runs the whole conversation once and records what came back.
+    // Expectations are checked on the test thread afterwards.
+    class Client : public juce::Thread
+    {
+    public:
+        Client(const juce::String& path_, const juce::MemoryBlock& state_)
+            : juce::Thread("RenderServiceTest client"), path(path_), state(state_) {}
+
+        ~Client() override
+        {
+            stopThread(1000);
+            disconnect();
+        }
+
+        void disconnect()
+        {
+            if (lastSocket >= 0) {
+                ::close(lastSocket);
+                lastSocket = -1;
+            }
+        }
+
+        uint32_t beforeHello = ~0u;
+        RenderProtocol::Reply hello;
+        bool mapped = false;
+        int numReplies = 0;
+        bool inOrder = true;
+        float slotOutput[numSlots] {};
+        uint32_t badSlot = ~0u, tooLong = ~0u, reset = ~0u, goodbye = ~0u;
+        uint32_t secondHello = ~0u;
+        float secondOutput = 0.0f;
+
+    private:
+        void run() override
+        {
+            hello.status = ~0u;
+
+            int s = connectTo();
+            if (s < 0) {
+                return;
+            }
+
+            RenderProtocol::Request request;
+            request.type = RenderProtocol::process;
+            beforeHello = call(s, request).status;
+
+            request = {};
+            request.type = RenderProtocol::hello;
+            request.slot = numSlots;
+            request.numSamples = blockSize;
+            request.sampleRate = 48000.0;
+            hello = call(s, request, state.getData(), uint32_t(state.getSize()));
+
+            size_t bytes = size_t(numSlots) * RenderProtocol::numChannels * blockSize * sizeof(float);
+            float* ring = hello.status == RenderProtocol::ok ? map(hello.sharedMemoryName, bytes) : nullptr;
+            mapped = ring != nullptr;
+
+            request = {};                               // settle the smoothers on the new state
+            request.type = RenderProtocol::reset;
+            reset = call(s, request).status;
+
+            if (ring != nullptr) {
+                // fill every slot, send all requests, then collect the replies
+                std::fill(ring, ring + bytes / sizeof(float), input);
+                for (int slot = 0; slot < numSlots; ++slot) {
+                    request = {};
+                    request.type = RenderProtocol::process;
+                    request.slot = uint32_t(slot);
+                    request.numSamples = blockSize;
+                    sendAll(s, &request, sizeof(request));
+                }
+                for (int slot = 0; slot < numSlots; ++slot) {
+                    RenderProtocol::Reply reply;
+                    if (!receiveAll(s, &reply, sizeof(reply)) || reply.status != RenderProtocol::ok) {
+                        break;
+                    }
+                    inOrder = inOrder && reply.slot == uint32_t(slot);
+                    slotOutput[slot] = ring[size_t(slot) * RenderProtocol::numChannels * blockSize];
+                    ++numReplies;
+                }
+                ::munmap(ring, bytes);
+            }
+
+            request = {};
+            request.type = RenderProtocol::process;
+            request.slot = numSlots;
+            request.numSamples = 16;
+            badSlot = call(s, request).status;
+
+            request.slot = 0;
+            request.numSamples = blockSize + 1;
+            tooLong = call(s, request).status;
+
+            request = {};
+            request.type = RenderProtocol::goodbye;
+            goodbye = call(s, request).status;
+            ::close(s);
+
+            // same warm processor, no state blob: must be back at 0 dB
+            s = connectTo();
+            if (s < 0) {
+                return;
+            }
+            request = {};
+            request.type = RenderProtocol::hello;
+            request.slot = 1;
+            request.numSamples = 64;
+            request.sampleRate = 48000.0;
+            auto reply = call(s, request);
+            secondHello = reply.status;
+            bytes = RenderProtocol::numChannels * 64 * sizeof(float);
+            ring = reply.status == RenderProtocol::ok ? map(reply.sharedMemoryName, bytes) : nullptr;
+            if (ring != nullptr) {
+                std::fill(ring, ring + bytes / sizeof(float), input);
+                request = {};
+                request.type = RenderProtocol::process;
+                request.numSamples = 64;
+                if (call(s, request).status == RenderProtocol::ok) {
+                    secondOutput = ring[0];
+                }
+                ::munmap(ring, bytes);
+            }
+
+            // stays connected: the test stops the service with this session open
+            lastSocket = s;
+        }
+
+        int connectTo() const
+        {
+            int s = ::socket(AF_UNIX, SOCK_STREAM, 0);
+            if (s < 0) {
+                return -1;
+            }
+            timeval timeout { 5, 0 };                   // never hang the test run
+            ::setsockopt(s, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+            sockaddr_un address {};
+            address.sun_family = AF_UNIX;
+            path.copyToUTF8(address.sun_path, sizeof(address.sun_path));
+            if (::connect(s, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) {
+                ::close(s);
+                return -1;
+            }
+            return s;
+        }
+
+        static float* map(const char* name, size_t bytes)
+        {
+            int fd = ::shm_open(name, O_RDWR, 0);
+            if (fd < 0) {
+                return nullptr;
+            }
+            void* data = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            ::close(fd);
+            return data == MAP_FAILED ? nullptr : static_cast<float*>(data);
+        }
+
+        static bool sendAll(int s, const void* data, size_t size)
+        {
+            auto* bytes = static_cast<const char*>(data);
+            while (size > 0) {
+                ssize_t n = ::send(s, bytes, size, MSG_NOSIGNAL);
+                if (n <= 0) {
+                    return false;
+                }
+                bytes += n;
+                size -= size_t(n);
+            }
+            return true;
+        }
+
+        static bool receiveAll(int s, void* data, size_t size)
+        {
+            auto* bytes = static_cast<char*>(data);
+            while (size > 0) {
+                ssize_t n = ::recv(s, bytes, size, 0);
+                if (n <= 0) {
+                    return false;
+                }
+                bytes += n;
+                size -= size_t(n);
+            }
+            return true;
+        }
+
+        // One request / reply round trip; status ~0 if the socket failed
+        static RenderProtocol::Reply call(int s, RenderProtocol::Request request,
+                                          const void* payload = nullptr, uint32_t payloadSize = 0)
+        {
+            request.payloadSize = payloadSize;
+            RenderProtocol::Reply reply;
+            if (!sendAll(s, &request, sizeof(request))
+                || (payloadSize > 0 && !sendAll(s, payload, payloadSize))
+                || !receiveAll(s, &reply, sizeof(reply))) {
+                reply.status = ~0u;
+            }
+            return reply;
+        }
+
+        juce::String path;
+        const juce::MemoryBlock& state;
+        int lastSocket = -1;
+    };
+};
+
+static RenderServiceTest renderServiceTest;
+
+#endif
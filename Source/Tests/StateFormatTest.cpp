@@ -0,0 +1,187 @@
+/*
+  ==============================================================================
+    StateFormatTest.cpp
+    Created: 17 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    The plug-in state is a compact binary ValueTree behind a magic / version
+    header, with the old binary-XML format still accepted on load.
+     - StateFormatTest: binary round trip, loading a legacy XML blob, and a
+       blob from a newer version being ignored rather than half-applied,
+     - StateFormatBenchmark (category "Benchmark"): save and load of a
+       1,000-instance session, binary vs. legacy XML.
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS
+
+#include "../PluginProcessor.h"
+
+// A few parameters away from their defaults, so a restore is visible
+static void setNonDefaultState(DelayAudioProcessor& processor)
+{
+    auto set = [&processor](const juce::ParameterID& id, float value) {
+        auto* param = processor.apvts.getParameter(id.getParamID());
+        param->setValueNotifyingHost(param->convertTo0to1(value));
+    };
+    set(gainParamID, -6.0f);
+    set(delayTimeParamID, 250.0f);
+    set(feedbackParamID, 40.0f);
+    set(lowCutParamID, 200.0f);
+}
+
+static float valueOf(DelayAudioProcessor& processor, const juce::ParameterID& id)
+{
+    return processor.apvts.getRawParameterValue(id.getParamID())->load();
+}
+
+class StateFormatTest : public juce::UnitTest
+{
+public:
+    StateFormatTest() : juce::UnitTest("Plug-in state format", "Delay") {}
+
+    void runTest() override
+    {
+        DelayAudioProcessor source;
+        setNonDefaultState(source);
+
+        beginTest("binary round trip");
+        {
+            juce::MemoryBlock state;
+            source.getStateInformation(state);
+            expect(!isXml(state), "saved as binary, not XML");
+
+            DelayAudioProcessor restored;
+            restored.setStateInformation(state.getData(), int(state.getSize()));
+            expectMatches(restored, source);
+        }
+
+        beginTest("legacy binary XML still loads");
+        {
+            juce::MemoryBlock state;
+            auto xml = source.apvts.copyState().createXml();
+            juce::AudioProcessor::copyXmlToBinary(*xml, state);
+            expect(isXml(state));
+
+            DelayAudioProcessor restored;
+            restored.setStateInformation(state.getData(), int(state.getSize()));
+            expectMatches(restored, source);
+        }
+
+        beginTest("state from a newer version is ignored");
+        {
+            juce::MemoryBlock state;
+            source.getStateInformation(state);
+            auto* header = static_cast<char*>(state.getData());
+            auto version = juce::ByteOrder::littleEndianInt(header + 4);    // magic | version | tree
+            version = juce::ByteOrder::swapIfBigEndian(version + 1);
+            std::memcpy(header + 4, &version, sizeof(version));
+
+            DelayAudioProcessor defaults, restored;
+            restored.setStateInformation(state.getData(), int(state.getSize()));
+            expectMatches(restored, defaults);
+        }
+
+        beginTest("garbage is ignored");
+        {
+            const char junk[] = "not a plug-in state";
+            DelayAudioProcessor defaults, restored;
+            restored.setStateInformation(junk, int(sizeof(junk)));
+            expectMatches(restored, defaults);
+        }
+    }
+
+private:
+    // copyXmlToBinary blobs start with JUCE's own magic number
+    static bool isXml(const juce::MemoryBlock& state)
+    {
+        return state.getSize() >= 4
+               && juce::ByteOrder::littleEndianInt(state.getData()) == 0x21324356;
+    }
+
+    void expectMatches(DelayAudioProcessor& actual, DelayAudioProcessor& expected)
+    {
+        for (auto* id : { &gainParamID, &delayTimeParamID, &feedbackParamID, &lowCutParamID }) {
+            expectWithinAbsoluteError(valueOf(actual, *id), valueOf(expected, *id), 0.001f, id->getParamID());
+        }
+    }
+};
+
+class StateFormatBenchmark : public juce::UnitTest
+{
+public:
+    StateFormatBenchmark() : juce::UnitTest("Plug-in state save / load, 1000 instances", "Benchmark") {}
+
+    void runTest() override
+    {
+        constexpr int numInstances = 1000;
+
+        std::vector<std::unique_ptr<DelayAudioProcessor>> session;
+        for (int i = 0; i < numInstances; ++i) {
+            session.push_back(std::make_unique<DelayAudioProcessor>());
+            setNonDefaultState(*session.back());
+        }
+
+        beginTest("binary");
+        std::vector<juce::MemoryBlock> states(session.size());
+        double save = time([&] {
+            for (size_t i = 0; i < session.size(); ++i) {
+                states[i].reset();
+                session[i]->getStateInformation(states[i]);
+            }
+        });
+        double load = time([&] {
+            for (size_t i = 0; i < session.size(); ++i) {
+                session[i]->setStateInformation(states[i].getData(), int(states[i].getSize()));
+            }
+        });
+        log("binary", save, load, states);
+        expectWithinAbsoluteError(valueOf(*session.back(), delayTimeParamID), 250.0f, 0.01f);
+
+        beginTest("legacy XML");
+        save = time([&] {
+            for (size_t i = 0; i < session.size(); ++i) {
+                states[i].reset();
+                auto xml = session[i]->apvts.copyState().createXml();
+                juce::AudioProcessor::copyXmlToBinary(*xml, states[i]);
+            }
+        });
+        load = time([&] {
+            for (size_t i = 0; i < session.size(); ++i) {
+                session[i]->setStateInformation(states[i].getData(), int(states[i].getSize()));
+            }
+        });
+        log("legacy XML", save, load, states);
+        expectWithinAbsoluteError(valueOf(*session.back(), delayTimeParamID), 250.0f, 0.01f);
+    }
+
+private:
+    template <typename Function>
+    static double time(Function&& function)
+    {
+        auto start = juce::Time::getMillisecondCounterHiRes();
+        function();
+        return juce::Time::getMillisecondCounterHiRes() - start;
+    }
+
+    void log(const juce::String& format, double save, double load, const std::vector<juce::MemoryBlock>& states)
+    {
+        size_t bytes = 0;
+        for (auto& state : states) {
+            bytes += state.getSize();
+        }
+        logMessage(format + ", " + juce::String(int(states.size())) + " instances: save "
+                   + juce::String(save, 2) + " ms, load " + juce::String(load, 2) + " ms, "
+                   + juce::String(juce::int64(bytes / states.size())) + " bytes per instance");
+    }
+};
+
+static StateFormatTest stateFormatTest;
+static StateFormatBenchmark stateFormatBenchmark;
+
+#endif
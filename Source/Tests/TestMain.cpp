@@ -0,0 +1,44 @@
+/*
+  ==============================================================================
+    TestMain.cpp
+    Created: 14 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    Entry point of the DelayTests console target (CMakeLists.txt): runs every
+    juce::UnitTest in Source/Tests and returns non-zero if any check failed.
+    Only compiled with DELAY_UNIT_TESTS=1, so plug-in targets that pick up
+    the whole Source tree never see this main().
+
+      DelayTests [category]      e.g. DelayTests Benchmark
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS
+
+#include <JuceHeader.h>
+
+int main(int argc, char* argv[])
+{
+    juce::ScopedJuceInitialiser_GUI juceInitialiser;   // message manager for timers / APVTS
+
+    juce::UnitTestRunner runner;
+    runner.setAssertOnFailure(false);
+    if (argc > 1) {
+        runner.runTestsInCategory(argv[1]);
+    } else {
+        runner.runAllTests();
+    }
+
+    int failures = 0;
+    for (int i = 0; i < runner.getNumResults(); ++i) {
+        failures += runner.getResult(i)->failures;
+    }
+    return failures == 0 ? 0 : 1;
+}
+
+#endif
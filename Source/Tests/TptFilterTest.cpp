@@ -0,0 +1,78 @@
+/*
+  ==============================================================================
+    TptFilterTest.cpp
+    Created: 15 May 2026
+    Author:  Michael J Evan
+             CIS-595 Independent Study
+             UMass Dartmouth
+             Graduate Computer Science Dept
+             Spring 2026
+
+    Note:
+    The core's TptFilter (Source/Core) replaced juce::dsp::StateVariableTPTFilter
+    in the feedback path; both must produce the same samples. Runs noise
+    through both, as low cut (highpass) and high cut (lowpass), at the
+    cutoffs and sample rates the plug-in uses, with a cutoff change halfway,
+    and expects bit-identical output.
+  ==============================================================================
+*/
+
+#if DELAY_UNIT_TESTS
+
+#include <JuceHeader.h>
+#include "../Core/TptFilter.h"
+
+class TptFilterTest : public juce::UnitTest
+{
+public:
+    TptFilterTest() : juce::UnitTest("TptFilter vs. StateVariableTPTFilter", "Delay") {}
+
+    void runTest() override
+    {
+        using JuceType = juce::dsp::StateVariableTPTFilterType;
+
+        beginTest("identical output");
+        for (double sampleRate : { 44100.0, 48000.0, 96000.0, 192000.0 }) {
+            for (float cutoff : { 20.0f, 150.0f, 1000.0f, 8000.0f, 20000.0f }) {
+                expect(matches(sampleRate, cutoff, JuceType::highpass, TptFilter::Type::highpass),
+                       "highpass " + juce::String(cutoff) + " Hz at " + juce::String(sampleRate));
+                expect(matches(sampleRate, cutoff, JuceType::lowpass, TptFilter::Type::lowpass),
+                       "lowpass " + juce::String(cutoff) + " Hz at " + juce::String(sampleRate));
+            }
+        }
+    }
+
+private:
+    bool matches(double sampleRate, float cutoff, juce::dsp::StateVariableTPTFilterType juceType,
+                 TptFilter::Type type)
+    {
+        juce::dsp::StateVariableTPTFilter<float> reference;
+        reference.setType(juceType);
+        reference.prepare({ sampleRate, 512, 1 });
+        reference.setCutoffFrequency(cutoff);
+
+        TptFilter filter;
+        filter.setType(type);
+        filter.prepare(sampleRate);
+        filter.setCutoffFrequency(cutoff);
+
+        juce::Random random(1234);
+        for (int i = 0; i < 4096; ++i) {
+            if (i == 2048) {                         // cutoff change mid-stream, as automation does
+                reference.setCutoffFrequency(cutoff * 0.5f);
+                filter.setCutoffFrequency(cutoff * 0.5f);
+            }
+            float x = random.nextFloat() * 2.0f - 1.0f;
+            float expected = reference.processSample(0, x);
+            float actual = filter.processSample(x);
+            if (std::memcmp(&expected, &actual, sizeof(float)) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+static TptFilterTest tptFilterTest;
+
+#endif